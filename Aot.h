@@ -0,0 +1,12 @@
+#ifndef AOT_H
+#define AOT_H
+
+#include <stdint.h>
+
+// Provided By A ROM Translated With chip8-aot (Only Linked Into -DAOT Builds)
+extern const char *AotROMName;
+
+void AotInitialize();
+void AotExecute(int instructions);
+
+#endif
@@ -3,29 +3,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
-#include <SDL2/SDL.h>
-
-#define GRID_WIDTH 64
-#define GRID_HEIGHT 32
-#define MEMORY_SIZE 4096
-#define FONT_SIZE 80
-#define MEMORY_STARTING_ADDRESS 0x200
-#define EMULATION_SPEED 60
-
-typedef struct
-{
-    uint8_t Memory[MEMORY_SIZE];
-    uint8_t Display[GRID_WIDTH * GRID_HEIGHT];
-    uint16_t PC;
-    uint16_t I;
-    uint16_t Stack[16];
-    uint8_t SP;
-    uint8_t Delay_Timer;
-    uint8_t Sound_Timer;
-    uint8_t V[16];
-    uint8_t Key[16];
-
-} CHIP8_CPU;
+#include "CHIP8.h"
+#include "Trace.h"
+#include "ExecTrace.h"
+#include "Jit.h"
+#include "Closure.h"
+#include "Fusion.h"
+#include "Idle.h"
+#include "Quirks.h"
 
 const uint8_t Chip8Font[FONT_SIZE] =
     {
@@ -48,6 +33,55 @@ const uint8_t Chip8Font[FONT_SIZE] =
 };
 
 CHIP8_CPU Chip8;
+void (*MemoryWriteHook)(int address, int length) = NULL;
+uint64_t SpritesDrawn = 0;
+uint32_t DisplayDirty = 0;
+
+// Decoded Program Image Alongside Chip8.Memory
+DecodedInstruction DecodedMemory[MEMORY_SIZE - 1];
+
+// Dispatch Tables Used At Decode Time (Top Nibble, Then Secondary Tables For Grouped Opcodes)
+OpcodeHandler MainTable[16];
+OpcodeHandler Table0[256];
+OpcodeHandler Table8[16];
+OpcodeHandler TableE[256];
+OpcodeHandler TableF[256];
+
+void InvalidateDecoded(int address, int length)
+{
+    // Drop Compiled Blocks Covering The Written Bytes
+    JitInvalidate(address, length);
+    ClosureInvalidate(address, length);
+    if (MemoryWriteHook != NULL)
+    {
+        MemoryWriteHook(address, length);
+    }
+
+    // A Write At Address Also Changes The Opcode Starting One Byte Before It
+    int start = address - 1;
+    int end = address + length;
+
+    if (start < 0)
+    {
+        start = 0;
+    }
+    if (end > MEMORY_SIZE - 1)
+    {
+        end = MEMORY_SIZE - 1;
+    }
+
+    for (int i = start; i < end; i++)
+    {
+        DecodedMemory[i].Handler = Op_Decode;
+    }
+
+    // Fused Sequences & Idle Loops Span Up To 3 Instructions, So Also Drop Any Starting Up To 5 Bytes Before
+    for (int i = (address > 5) ? address - 5 : 0; i < end; i++)
+    {
+        DecodedMemory[i].Fused = NULL;
+        DecodedMemory[i].IdleLoop = IDLE_NONE;
+    }
+}
 
 void InitializeChip8()
 {
@@ -55,8 +89,14 @@ void InitializeChip8()
     Chip8.PC = MEMORY_STARTING_ADDRESS;
     Chip8.I = 0;
     Chip8.SP = 0;
-    Chip8.Delay_Timer = 0;
-    Chip8.Sound_Timer = 0;
+    Chip8.Delay_Timer = (CHIP8_TIMER){0, 0};
+    Chip8.Sound_Timer = (CHIP8_TIMER){0, 0};
+    Chip8.Cycles = 0;
+    Chip8.TickCycles = INSTRUCTIONS_PER_FRAME;
+    Chip8.TickOrigin = 0;
+    Chip8.Halted = false;
+    Chip8.HaltRegister = 0;
+    SeedRandom(DEFAULT_SEED);
 
     // Initalize Stack, V-Registers & Keys
     for (int i = 0; i < 16; i++)
@@ -66,8 +106,8 @@ void InitializeChip8()
         Chip8.Key[i] = 0;
     }
 
-    // Initalize Memory
-    for (int i = 0; i < MEMORY_SIZE; i++)
+    // Initalize Memory & The Guard Behind It
+    for (int i = 0; i < MEMORY_SIZE + MEMORY_GUARD; i++)
     {
         Chip8.Memory[i] = 0;
     }
@@ -77,45 +117,24 @@ void InitializeChip8()
     {
         Chip8.Memory[0x000 + i] = Chip8Font[i];
     }
-}
 
-void ClearDisplay()
-{
-    // (Initalize) Clear Display
-    for (int i = 0; i < (GRID_WIDTH * GRID_HEIGHT); i++)
-    {
-        Chip8.Display[i] = 0;
-    }
+    // Initalize Decoded Program Image
+    InvalidateDecoded(0, MEMORY_SIZE);
 }
 
-void DrawSprite(uint8_t X, uint8_t Y, uint8_t N)
+void ClearDisplay()
 {
-    // Make Copy of Vx & Vy (As I Wipe Vf to 0 )
-    uint8_t Vx = Chip8.V[X];
-    uint8_t Vy = Chip8.V[Y];
-
-    // Clear the collision flag
-    Chip8.V[0xF] = 0;
-
-    // Iterate over each line of the sprite
-    for (int line = 0; line < N; line++)
+    // Only Rows With Something Lit Change
+    for (int y = 0; y < GRID_HEIGHT; y++)
     {
-        for (int bit = 0; bit < 8; bit++)
+        if (Chip8.Display[y] != 0)
         {
-            // Check if the current bit is set in the sprite byte
-            if (((Chip8.Memory[Chip8.I + line]) & (0x80 >> bit)) != 0)
-            {
-                // Check for collision
-                if (Chip8.Display[((Vy + line) % GRID_HEIGHT) * GRID_WIDTH + ((Vx + bit) % GRID_WIDTH)] == 1)
-                {
-                    Chip8.V[0xF] = 1;
-                }
-
-                // XOR the bit on the display
-                Chip8.Display[((Vy + line) % GRID_HEIGHT) * GRID_WIDTH + ((Vx + bit) % GRID_WIDTH)] ^= 1;
-            }
+            DisplayDirty |= 1u << y;
         }
     }
+
+    // (Initalize) Clear Display
+    memset(Chip8.Display, 0, sizeof(Chip8.Display));
 }
 
 bool LoadROM(const char *file)
@@ -168,6 +187,9 @@ bool LoadROM(const char *file)
         // ROM Loaded Succesfully,
         else
         {
+            InvalidateDecoded(MEMORY_STARTING_ADDRESS, ROMSize);
+            FuseInstructions(MEMORY_STARTING_ADDRESS, ROMSize);
+            FindIdleLoops(MEMORY_STARTING_ADDRESS, ROMSize);
             printf("ROM Size: %db\n", ROMSize);
             fclose(ROM);
             return 0;
@@ -175,673 +197,569 @@ bool LoadROM(const char *file)
     }
 }
 
-void ExecuteInstructions()
+// Unknown Opcode - Ignored
+void Op_Unknown(DecodedInstruction *D)
 {
-    // Combine 2 Byte From Memory To Make One Opcode
-    uint16_t opcode = Chip8.Memory[Chip8.PC] << 8 | Chip8.Memory[Chip8.PC + 1];
+}
 
-    // Update Program Counter
-    Chip8.PC += 2;
+// 00E0 - Clear Display
+void Op_00E0(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 00E0 - Clear Display %04x\n", D);
+    ClearDisplay();
+}
 
-    // 0x0
-    if ((opcode & 0xF000) == 0x0000)
+// 00EE - Return
+void Op_00EE(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 00EE - Return %04x\n", D);
+    if (Chip8.SP > 0)
     {
-        // 00E0 - Clear Display
-        if ((opcode & 0x0FFF) == 0x00E0)
-        {
-            printf("%04x 00E0 - Clear Display %04x\n", opcode, Chip8.PC);
-            ClearDisplay();
-        }
-        // 00EE - Return
-        else if ((opcode & 0x0FFF) == 0x00EE)
-        {
-            printf("%04x 00EE - Return %04x\n", opcode, Chip8.PC);
-            if (Chip8.SP > 0)
-            {
-                Chip8.SP--;
-                Chip8.PC = Chip8.Stack[Chip8.SP];
-            }
-            else
-            {
-                // Handle stack underflow error
-                printf("Error: Stack underflow at PC %04x\n", Chip8.PC);
-            }
-        }
+        Chip8.SP--;
+        Chip8.PC = Chip8.Stack[STACK_INDEX(Chip8.SP)];
     }
-
-    // 1NNN - Goto NNN
-    if ((opcode & 0xF000) == 0x1000)
+    else
     {
-        printf("%04x 1NNN - GoTo NNN %04x\n", opcode, Chip8.PC);
-        Chip8.PC = (opcode & 0x0FFF);
+        // Handle stack underflow error
+        printf("Error: Stack underflow at PC %04x\n", Chip8.PC);
     }
+}
 
-    // 2NNN - Calls subroutine at NNN
-    if ((opcode & 0xF000) == 0x2000)
-    {
-        printf("%04x 2NNN - Call Subroutine at NNN %04x\n", opcode, Chip8.PC);
-        Chip8.Stack[Chip8.SP] = Chip8.PC;
-        Chip8.SP++;
-        Chip8.PC = (opcode & 0x0FFF);
-    }
+// 1NNN - Goto NNN
+void Op_1NNN(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 1NNN - GoTo NNN %04x\n", D);
+    Chip8.PC = D->NNN;
+}
 
-    // 3XNN - SKIP Instruction if(Vx == NN)
-    if ((opcode & 0xF000) == 0x3000)
-    {
-        if (Chip8.V[((opcode & 0x0F00) >> 8)] == (opcode & 0x00FF))
-        {
-            printf("%04x 3XNN - SKIP INSTR Vx == NN TRUE %04x\n", opcode, Chip8.PC);
-            Chip8.PC += 2;
-        }
-    }
+// 2NNN - Calls subroutine at NNN
+void Op_2NNN(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 2NNN - Call Subroutine at NNN %04x\n", D);
+    Chip8.Stack[STACK_INDEX(Chip8.SP)] = Chip8.PC;
+    Chip8.SP++;
+    Chip8.PC = D->NNN;
+}
 
-    // 4XNN - SKIP Instruction if(Vx != NN)
-    if ((opcode & 0xF000) == 0x4000)
+// 3XNN - SKIP Instruction if(Vx == NN)
+void Op_3XNN(DecodedInstruction *D)
+{
+    if (Chip8.V[D->X] == D->NN)
     {
-        if (Chip8.V[((opcode & 0x0F00) >> 8)] != (opcode & 0x00FF))
-        {
-            printf("%04x 4XNN - SKIP INSTR Vx != NN TRUE %04x\n", opcode, Chip8.PC);
-            Chip8.PC += 2;
-        }
-    }
-
-    // 5XY0 - SKIP Instruction if(Vx == Vy)
-    if ((opcode & 0xF00F) == 0x5000)
-    {
-        if (Chip8.V[((opcode & 0x0F00) >> 8)] == Chip8.V[((opcode & 0x00F0) >> 4)])
-        {
-            printf("%04x 5XY0 - SKIP INSTR Vx == Vy TRUE %04x\n", opcode, Chip8.PC);
-            Chip8.PC += 2;
-        }
+        TRACE_OPCODE("%04x 3XNN - SKIP INSTR Vx == NN TRUE %04x\n", D);
+        Chip8.PC += 2;
     }
+}
 
-    // 6XNN - SET Vx = NN
-    if ((opcode & 0xF000) == 0x6000)
+// 4XNN - SKIP Instruction if(Vx != NN)
+void Op_4XNN(DecodedInstruction *D)
+{
+    if (Chip8.V[D->X] != D->NN)
     {
-        printf("%04x 6XNN - SET Vx = NN %04x\n", opcode, Chip8.PC);
-        Chip8.V[((opcode & 0x0F00) >> 8)] = (opcode & 0x00FF);
+        TRACE_OPCODE("%04x 4XNN - SKIP INSTR Vx != NN TRUE %04x\n", D);
+        Chip8.PC += 2;
     }
+}
 
-    // 7XNN - ADD Vx += NN
-    if ((opcode & 0xF000) == 0x7000)
+// 5XY0 - SKIP Instruction if(Vx == Vy)
+void Op_5XY0(DecodedInstruction *D)
+{
+    if (Chip8.V[D->X] == Chip8.V[D->Y])
     {
-        printf("%04x 7XNN - ADD Vx += NN %04x\n", opcode, Chip8.PC);
-        Chip8.V[((opcode & 0x0F00) >> 8)] = (Chip8.V[((opcode & 0x0F00) >> 8)] + (opcode & 0x00FF)) & 0xFF;
+        TRACE_OPCODE("%04x 5XY0 - SKIP INSTR Vx == Vy TRUE %04x\n", D);
+        Chip8.PC += 2;
     }
+}
 
-    // 0x8
-    if ((opcode & 0xF000) == 0x8000)
-    {
-        // 8XY0 - SET Vx = Vy
-        if ((opcode & 0x000F) == 0x0000)
-        {
-            printf("%04x 8XY0 - SET Vx = Vy %04x\n", opcode, Chip8.PC);
-            Chip8.V[((opcode & 0x0F00) >> 8)] = Chip8.V[((opcode & 0x00F0) >> 4)];
-        }
-
-        // 8XY1 - SET Vx |= Vy
-        else if ((opcode & 0x000F) == 0x0001)
-        {
-            printf("%04x 8XY1 - SET Vx |= NN %04x\n", opcode, Chip8.PC);
-            Chip8.V[((opcode & 0x0F00) >> 8)] = Chip8.V[((opcode & 0x0F00) >> 8)] | Chip8.V[((opcode & 0x00F0) >> 4)];
-        }
-
-        // 8XY2 - SET Vx &= Vy
-        else if ((opcode & 0x000F) == 0x0002)
-        {
-            printf("%04x 8XY2 - SET Vx &= Vy %04x\n", opcode, Chip8.PC);
-            Chip8.V[((opcode & 0x0F00) >> 8)] = Chip8.V[((opcode & 0x0F00) >> 8)] & Chip8.V[((opcode & 0x00F0) >> 4)];
-        }
-
-        // 8XY3 - SET Vx ^= Vy
-        else if ((opcode & 0x000F) == 0x0003)
-        {
-            printf("%04x 8XY3 - SET Vx ^= Vy %04x\n", opcode, Chip8.PC);
-            Chip8.V[((opcode & 0x0F00) >> 8)] = Chip8.V[((opcode & 0x0F00) >> 8)] ^ Chip8.V[((opcode & 0x00F0) >> 4)];
-        }
+// 6XNN - SET Vx = NN
+void Op_6XNN(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 6XNN - SET Vx = NN %04x\n", D);
+    Chip8.V[D->X] = D->NN;
+}
 
-        // 8XY4 - SET Vx += Vy
-        else if ((opcode & 0x000F) == 0x0004)
-        {
-            // Extract the X and Y register indices
-            uint8_t X = (opcode & 0x0F00) >> 8;
-            uint8_t Y = (opcode & 0x00F0) >> 4;
+// 7XNN - ADD Vx += NN
+void Op_7XNN(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 7XNN - ADD Vx += NN %04x\n", D);
+    Chip8.V[D->X] = (Chip8.V[D->X] + D->NN) & 0xFF;
+}
 
-            // Calculate the sum and check for overflow
-            uint16_t sum = Chip8.V[X] + Chip8.V[Y];
+// 8XY0 - SET Vx = Vy
+void Op_8XY0(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 8XY0 - SET Vx = Vy %04x\n", D);
+    Chip8.V[D->X] = Chip8.V[D->Y];
+}
 
-            // ADD
-            Chip8.V[X] = sum & 0xFF;
+// 8XY4 - SET Vx += Vy
+void Op_8XY4(DecodedInstruction *D)
+{
+    // Extract the X and Y register indices
+    uint8_t X = D->X;
+    uint8_t Y = D->Y;
 
-            // Set Flag
-            Chip8.V[0xF] = (sum > 255) ? 1 : 0;
-        }
+    // Calculate the sum and check for overflow
+    uint16_t sum = Chip8.V[X] + Chip8.V[Y];
 
-        // 8XY5 - SET Vx -= Vy
-        else if ((opcode & 0x000F) == 0x0005)
-        {
-            // Extract the X and Y register indices
-            uint8_t X = (opcode & 0x0F00) >> 8;
-            uint8_t Y = (opcode & 0x00F0) >> 4;
+    // ADD
+    Chip8.V[X] = sum & 0xFF;
 
-            // Extract X and Y (not changed due to SUB)
-            uint8_t Vx = Chip8.V[X];
-            uint8_t Vy = Chip8.V[Y];
+    // Set Flag
+    Chip8.V[0xF] = (sum > 255) ? 1 : 0;
+}
 
-            // SUB
-            Chip8.V[X] = (Chip8.V[X] - Chip8.V[Y]) & 0xFF;
+// 8XY5 - SET Vx -= Vy
+void Op_8XY5(DecodedInstruction *D)
+{
+    // Extract the X and Y register indices
+    uint8_t X = D->X;
+    uint8_t Y = D->Y;
 
-            // Set Flag
-            Chip8.V[0xF] = (Vx >= Vy) ? 0x1 : 0x0;
-        }
+    // Extract X and Y (not changed due to SUB)
+    uint8_t Vx = Chip8.V[X];
+    uint8_t Vy = Chip8.V[Y];
 
-        // 8XY6 - SET Vx >>= 1
-        else if ((opcode & 0x000F) == 0x0006)
-        {
-            // Set Flag of LSB
-            Chip8.V[0xF] = Chip8.V[(opcode & 0x0F00) >> 8] & 1;
+    // SUB
+    Chip8.V[X] = (Chip8.V[X] - Chip8.V[Y]) & 0xFF;
 
-            // Shift X Right
-            Chip8.V[(opcode & 0x0F00) >> 8] >>= 1;
-        }
+    // Set Flag
+    Chip8.V[0xF] = (Vx >= Vy) ? 0x1 : 0x0;
+}
 
-        // 8XY7 - SET Vx = Vy - Vx
-        else if ((opcode & 0x000F) == 0x0007)
-        {
-            // Extract the X and Y register indices
-            uint8_t X = (opcode & 0x0F00) >> 8;
-            uint8_t Y = (opcode & 0x00F0) >> 4;
+// 8XY7 - SET Vx = Vy - Vx
+void Op_8XY7(DecodedInstruction *D)
+{
+    // Extract the X and Y register indices
+    uint8_t X = D->X;
+    uint8_t Y = D->Y;
 
-            // REV SUB
-            Chip8.V[X] = Chip8.V[Y] - Chip8.V[X];
+    // REV SUB
+    Chip8.V[X] = Chip8.V[Y] - Chip8.V[X];
 
-            // Set Flag
-            Chip8.V[0xF] = (Chip8.V[Y] >= Chip8.V[X]) ? 1 : 0;
-        }
+    // Set Flag
+    Chip8.V[0xF] = (Chip8.V[Y] >= Chip8.V[X]) ? 1 : 0;
+}
 
-        // 8XYE - SET Vx <<= 1
-        else if ((opcode & 0x000F) == 0x000E)
-        {
-            uint8_t X = (opcode & 0x0F00) >> 8;
+// 9XY0 - SKIP Instruction if(Vx != Vy)
+void Op_9XY0(DecodedInstruction *D)
+{
+    if (Chip8.V[D->X] != Chip8.V[D->Y])
+    {
+        TRACE_OPCODE("%04x 8XYE - SKIP INSTR Vx != Vy TRUE %04x\n", D);
+        Chip8.PC += 2;
+    }
+}
 
-            // Flag
-            Chip8.V[0xF] = Chip8.V[X] >> 7;
+// ANNN - SET I = NNN
+void Op_ANNN(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x ANNN - SET I = NNN TRUE %04x\n", D);
+    Chip8.I = D->NNN;
+}
 
-            // Shift
-            Chip8.V[X] <<= 1;
-        }
-    }
+// CXNN - SET Vx = rand(0-255) & NN
+void Op_CXNN(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x CXNN - SET Vx = rand(0-255) & NN %04x\n", D);
+    Chip8.V[D->X] = NextRandom() & D->NN;
+}
 
-    // 9XY0 - SKIP Instruction if(Vx != Vy)
-    if ((opcode & 0xF00F) == 0x9000)
+// EX9E - SKIP if(key[Vx] == 1)
+void Op_EX9E(DecodedInstruction *D)
+{
+    if (Chip8.Key[Chip8.V[D->X] & 0xF] != 0)
     {
-        if (Chip8.V[((opcode & 0x0F00) >> 8)] != Chip8.V[((opcode & 0x00F0) >> 4)])
-        {
-            printf("%04x 8XYE - SKIP INSTR Vx != Vy TRUE %04x\n", opcode, Chip8.PC);
-            Chip8.PC += 2;
-        }
+        TRACE_OPCODE("%04x EX9E - NOT SKIP if(key[Vx] != 0) %04x\n", D);
+        Chip8.PC += 2;
     }
+}
 
-    // ANNN - SET I = NNN
-    if ((opcode & 0xF000) == 0xA000)
+// EXA1 - SKIP if(key[Vx] != 1)
+void Op_EXA1(DecodedInstruction *D)
+{
+    if (Chip8.Key[Chip8.V[D->X] & 0xF] == 0)
     {
-        printf("%04x ANNN - SET I = NNN TRUE %04x\n", opcode, Chip8.PC);
-        Chip8.I = (opcode & 0x0FFF);
+        TRACE_OPCODE("%04x EXA1 - NOT SKIP if(key[Vx] == 0) %04x\n", D);
+        Chip8.PC += 2;
     }
+}
 
-    // BNNN - SET PC = V0 + NNN
-    if ((opcode & 0xF000) == 0xB000)
-    {
-        printf("%04x BNNN - SET PC = V0 + NNN %04x\n", opcode, Chip8.PC);
-        Chip8.PC = Chip8.V[0x0] + (opcode & 0x0FFF);
-    }
+// FX07 - SET Vx = Delay_Timer
+void Op_FX07(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x FX07 - SET Vx = Delay_Timer %04x\n", D);
+    Chip8.V[D->X] = ReadTimer(&Chip8.Delay_Timer, Chip8.Cycles);
+}
 
-    // CXNN - SET Vx = rand(0-255) & NN
-    if ((opcode & 0xF000) == 0xC000)
+// FX0A - AWAIT EXEC UNTIL if(AnyKey == 1) & Store (AnyKey == 1) = Vx
+void Op_FX0A(DecodedInstruction *D)
+{
+    // Reset VF
+    Chip8.V[0xF] = 0;
+
+    // Halt Until A Key Is Down (WaitingForKey Finishes The Instruction)
+    TRACE_OPCODE("%04x FX0A - AWAIT EXEC UNTIL if(AnyKey == 1) & Store (AnyKey == 1) = Vx %04x\n", D);
+    Chip8.Halted = true;
+    Chip8.HaltRegister = D->X;
+    WaitingForKey();
+}
+
+// FX15 - SET Delay_Timer = Vx
+void Op_FX15(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x FX15 - SET Delay_Timer = Vx %04x\n", D);
+    WriteTimer(&Chip8.Delay_Timer, Chip8.V[D->X], Chip8.Cycles);
+}
+
+// FX18 - SET Sound_Timer = Vx
+void Op_FX18(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x FX18 - SET Sound_Timer = Vx %04x\n", D);
+    WriteTimer(&Chip8.Sound_Timer, Chip8.V[D->X], Chip8.Cycles);
+}
+
+// FX1E - SET I += Vx
+void Op_FX1E(DecodedInstruction *D)
+{
+    uint8_t X = D->X;
+
+    TRACE_OPCODE("%04x FX1E - SET I += Vx %04x\n", D);
+    Chip8.I += Chip8.V[X];
+}
+
+// FX29 - SET I = Sprite_Address of Vx
+void Op_FX29(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x FX29 - SET I = Sprite_Address of Vx %04x\n", D);
+    Chip8.I = Chip8.V[D->X] * 5;
+}
+
+// FX33 - BCD of Vx At I[0] = BCD(100), I[1] = BCD(10), I[2] = BCD(1)
+void Op_FX33(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x FX33 - BCD of Vx At I[0] = BCD(100), I[1] = BCD(10), I[2] = BCD(1) %04x\n", D);
+    uint16_t address = MEMORY_ADDRESS(Chip8.I, 3);
+    Chip8.Memory[address] = Chip8.V[D->X] / 100;
+    Chip8.Memory[address + 1] = ((Chip8.V[D->X]) / 10) % 10;
+    Chip8.Memory[address + 2] = Chip8.V[D->X] % 10;
+    InvalidateDecoded(address, 3);
+}
+
+// Opcodes That Differ Between Variants Come From The Active Quirk Profile
+void InitializeOpcodeTables()
+{
+    // Default Every Slot To Unknown Opcode
+    for (int i = 0; i < 256; i++)
     {
-        printf("%04x CXNN - SET Vx = rand(0-255) & NN %04x\n", opcode, Chip8.PC);
-        Chip8.V[((opcode & 0x0F00) >> 8)] = (rand() % 0x100) & (opcode & 0x00FF);
+        Table0[i] = Op_Unknown;
+        TableE[i] = Op_Unknown;
+        TableF[i] = Op_Unknown;
     }
-
-    // DXYN - DISPLAY draw(Vx, Vy, N)
-    if ((opcode & 0xF000) == 0xD000)
+    for (int i = 0; i < 16; i++)
     {
-        printf("%04x DXYN - DISPLAY %04x\n", opcode, Chip8.PC);
-        DrawSprite(((opcode & 0x0F00) >> 8), ((opcode & 0x00F0) >> 4), (opcode & 0x000F));
+        MainTable[i] = Op_Unknown;
+        Table8[i] = Op_Unknown;
     }
 
-    // 0xE
-    if ((opcode & 0xF000) == 0xE000)
+    // Top Nibble (Grouped Opcodes Resolve Through Their Secondary Table)
+    MainTable[0x1] = Op_1NNN;
+    MainTable[0x2] = Op_2NNN;
+    MainTable[0x3] = Op_3XNN;
+    MainTable[0x4] = Op_4XNN;
+    MainTable[0x5] = Op_5XY0;
+    MainTable[0x6] = Op_6XNN;
+    MainTable[0x7] = Op_7XNN;
+    MainTable[0x9] = Op_9XY0;
+    MainTable[0xA] = Op_ANNN;
+    MainTable[0xB] = Profile->Jump;
+    MainTable[0xC] = Op_CXNN;
+    MainTable[0xD] = Profile->Draw;
+
+    // 0x0 Group
+    Table0[0xE0] = Op_00E0;
+    Table0[0xEE] = Op_00EE;
+
+    // 0x8 Group
+    Table8[0x0] = Op_8XY0;
+    Table8[0x1] = Profile->Or;
+    Table8[0x2] = Profile->And;
+    Table8[0x3] = Profile->Xor;
+    Table8[0x4] = Op_8XY4;
+    Table8[0x5] = Op_8XY5;
+    Table8[0x6] = Profile->ShiftRight;
+    Table8[0x7] = Op_8XY7;
+    Table8[0xE] = Profile->ShiftLeft;
+
+    // 0xE Group
+    TableE[0x9E] = Op_EX9E;
+    TableE[0xA1] = Op_EXA1;
+
+    // 0xF Group
+    TableF[0x07] = Op_FX07;
+    TableF[0x0A] = Op_FX0A;
+    TableF[0x15] = Op_FX15;
+    TableF[0x18] = Op_FX18;
+    TableF[0x1E] = Op_FX1E;
+    TableF[0x29] = Op_FX29;
+    TableF[0x33] = Op_FX33;
+    TableF[0x55] = Profile->Store;
+    TableF[0x65] = Profile->Load;
+}
+
+OpcodeHandler ResolveHandler(uint16_t opcode)
+{
+    switch (opcode >> 12)
     {
-        // EX9E - SKIP if(key[Vx] == 1)
-        if ((opcode & 0x00FF) == 0x009E)
-        {
-            if (Chip8.Key[Chip8.V[(((opcode & 0x0F00) >> 8) & 0xF)]] != 0)
-            {
-                printf("%04x EX9E - NOT SKIP if(key[Vx] != 0) %04x\n", opcode, Chip8.PC);
-                Chip8.PC += 2;
-            }
-        }
+    // 0x0 - Only 00XX Opcodes Are Valid
+    case 0x0:
+        return ((opcode & 0x0F00) == 0x0000) ? Table0[opcode & 0x00FF] : Op_Unknown;
 
-        // EXA1 - SKIP if(key[Vx] != 1)
-        if ((opcode & 0x00FF) == 0x00A1)
-        {
-            if (Chip8.Key[Chip8.V[(((opcode & 0x0F00) >> 8) & 0xF)]] == 0)
-            {
-                printf("%04x EXA1 - NOT SKIP if(key[Vx] == 0) %04x\n", opcode, Chip8.PC);
-                Chip8.PC += 2;
-            }
-        }
-    }
+    // 5XY0 & 9XY0 - Low Nibble Must Be Zero
+    case 0x5:
+    case 0x9:
+        return ((opcode & 0x000F) == 0x0000) ? MainTable[opcode >> 12] : Op_Unknown;
 
-    // 0xF
-    if ((opcode & 0xF000) == 0xF000)
-    {
-        // FX07 - SET Vx = Delay_Timer
-        if ((opcode & 0x00FF) == 0x0007)
-        {
-            printf("%04x FX07 - SET Vx = Delay_Timer %04x\n", opcode, Chip8.PC);
-            Chip8.V[((opcode & 0x0F00) >> 8)] = Chip8.Delay_Timer;
-        }
+    case 0x8:
+        return Table8[opcode & 0x000F];
 
-        // FX0A - AWAIT EXEC UNTIL if(AnyKey == 1) & Store (AnyKey == 1) = Vx
-        if ((opcode & 0x00FF) == 0x000A)
-        {
-            // Reset VF
-            Chip8.V[0xF] = 0;
-
-            bool key_pressed = false;
-            for (int i = 0; i < 16; i++)
-            {
-                if (Chip8.Key[i] == 1)
-                {
-                    key_pressed = true;
-                    Chip8.V[((opcode & 0x0F00) >> 8)] = i;
-                    break;
-                }
-            }
-            if (key_pressed == false)
-            {
-                printf("%04x FX0A - AWAIT EXEC UNTIL if(AnyKey == 1) & Store (AnyKey == 1) = Vx %04x\n", opcode, Chip8.PC);
-                Chip8.PC -= 2;
-            }
-            else
-            {
-                return;
-            }
-        }
+    case 0xE:
+        return TableE[opcode & 0x00FF];
 
-        // FX15 - SET Delay_Timer = Vx
-        if ((opcode & 0x00FF) == 0x0015)
-        {
-            printf("%04x FX15 - SET Delay_Timer = Vx %04x\n", opcode, Chip8.PC);
-            Chip8.Delay_Timer = Chip8.V[((opcode & 0x0F00) >> 8)];
-        }
+    case 0xF:
+        return TableF[opcode & 0x00FF];
 
-        // FX18 - SET Sound_Timer = Vx
-        if ((opcode & 0x00FF) == 0x0018)
-        {
-            printf("%04x FX18 - SET Sound_Timer = Vx %04x\n", opcode, Chip8.PC);
-            Chip8.Sound_Timer = Chip8.V[((opcode & 0x0F00) >> 8)];
-        }
+    default:
+        return MainTable[opcode >> 12];
+    }
+}
 
-        // FX1E - SET I += Vx
-        if ((opcode & 0x00FF) == 0x001E)
-        {
-            uint8_t X = ((opcode & 0x0F00) >> 8);
+void DecodeInstruction(uint16_t address, DecodedInstruction *D)
+{
+    // Combine 2 Byte From Memory To Make One Opcode (PC Can Run Past 0xFFF, BNNN Can Land Up To 0x10FE)
+    uint16_t at = MEMORY_ADDRESS(address, 2);
+    uint16_t opcode = Chip8.Memory[at] << 8 | Chip8.Memory[at + 1];
+
+    // Extract Operands Once
+    D->Opcode = opcode;
+    D->X = (opcode & 0x0F00) >> 8;
+    D->Y = (opcode & 0x00F0) >> 4;
+    D->N = (opcode & 0x000F);
+    D->NN = (opcode & 0x00FF);
+    D->NNN = (opcode & 0x0FFF);
+    D->Handler = ResolveHandler(opcode);
+}
 
-            printf("%04x FX1E - SET I += Vx %04x\n", opcode, Chip8.PC);
-            Chip8.I += Chip8.V[X];
-        }
+// Placeholder Handler For Stale Entries, Decodes In Place Then Executes
+void Op_Decode(DecodedInstruction *D)
+{
+    DecodeInstruction(D - DecodedMemory, D);
+    D->Handler(D);
+}
 
-        // FX29 - SET I = Sprite_Address of Vx
-        if ((opcode & 0x00FF) == 0x0029)
-        {
-            printf("%04x FX29 - SET I = Sprite_Address of Vx %04x\n", opcode, Chip8.PC);
-            Chip8.I = Chip8.V[(((opcode & 0x0F00)) >> 8) & 0xF] * 5;
-        }
+// Timer Ticks Up To & Including Cycle (A Tick Lands On Every Multiple Of TickCycles Past TickOrigin)
+static uint64_t TimerTicks(uint64_t cycles)
+{
+    return (cycles - Chip8.TickOrigin + Chip8.TickCycles - 1) / Chip8.TickCycles;
+}
 
-        // FX33 - BCD of Vx At I[0] = BCD(100), I[1] = BCD(10), I[2] = BCD(1)
-        if ((opcode & 0x00FF) == 0x0033)
-        {
-            printf("%04x FX33 - BCD of Vx At I[0] = BCD(100), I[1] = BCD(10), I[2] = BCD(1) %04x\n", opcode, Chip8.PC);
-            Chip8.Memory[Chip8.I] = Chip8.V[((opcode & 0x0F00) >> 8)] / 100;
-            Chip8.Memory[Chip8.I + 1] = ((Chip8.V[((opcode & 0x0F00) >> 8)]) / 10) % 10;
-            Chip8.Memory[Chip8.I + 2] = Chip8.V[((opcode & 0x0F00) >> 8)] % 10;
-        }
+// Value Seen By An Instruction Running On Cycle, Counting Down From The Write
+uint8_t ReadTimer(const CHIP8_TIMER *Timer, uint64_t cycles)
+{
+    uint64_t elapsed = TimerTicks(cycles) - TimerTicks(Timer->Cycle);
+    return (elapsed >= Timer->Value) ? 0 : (uint8_t)(Timer->Value - elapsed);
+}
 
-        // FX55 - SET Memory[I + i] = V[i]
-        if ((opcode & 0x00FF) == 0x0055)
-        {
-            for (int i = 0; i <= ((opcode & 0x0F00) >> 8); i++)
-            {
-                Chip8.Memory[(Chip8.I + i)] = Chip8.V[i];
-            }
-            Chip8.I += (((opcode & 0x0F00) >> 8) + 1);
-        }
+void WriteTimer(CHIP8_TIMER *Timer, uint8_t value, uint64_t cycles)
+{
+    Timer->Value = value;
+    Timer->Cycle = cycles;
+}
 
-        // FX65 - SET V[i] = Memory[I + i]
-        if ((opcode & 0x00FF) == 0x0065)
-        {
-            printf("%04x FX65 - SET V[i] = Memory[I + i] %04x\n", opcode, Chip8.PC);
-            for (int i = 0; i <= ((opcode & 0x0F00) >> 8); i++)
-            {
-                Chip8.V[i] = Chip8.Memory[(Chip8.I + i)];
-            }
-        }
-    }
+// Instructions After Cycle That Still Read The Same Timer Values
+uint64_t CyclesToNextTick(uint64_t cycles)
+{
+    return TimerTicks(cycles + 1) * Chip8.TickCycles + Chip8.TickOrigin - cycles;
 }
 
-void AudioCallback(void *userdata, Uint8 *stream, int len)
+// Change The Frame Length On A Frame Boundary: Ticks Are Counted From Here On & Both Timers Carry
+// Over The Values The Next Instruction Would Have Read
+void SetTickCycles(uint32_t tickCycles)
 {
-    float *buffer = (float *)stream;
-    int samples = len / sizeof(float);
-    static float phase = 0.0f;
+    uint64_t next = Chip8.Cycles + 1;
+    uint8_t delay = ReadTimer(&Chip8.Delay_Timer, next);
+    uint8_t sound = ReadTimer(&Chip8.Sound_Timer, next);
+
+    Chip8.TickOrigin = Chip8.Cycles;
+    Chip8.TickCycles = tickCycles;
+    WriteTimer(&Chip8.Delay_Timer, delay, next);
+    WriteTimer(&Chip8.Sound_Timer, sound, next);
+}
 
-    for (int i = 0; i < samples; i++)
+// Leave The FX0A Halt Once Any Key Is Down, True While Still Waiting
+bool WaitingForKey()
+{
+    if (!Chip8.Halted)
     {
-        if (Chip8.Sound_Timer > 0) // Generate sound only when the timer is active
-        {
-            buffer[i] = sinf(phase * 2.0f * M_PI) * 0.5f; // Sine wave for the beep
-            phase += 440.0f / 44100.0f;                   // 440 Hz tone
-            if (phase >= 1.0f)
-                phase -= 1.0f;
-        }
-        else
+        return false;
+    }
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (Chip8.Key[i] == 1)
         {
-            buffer[i] = 0.0f; // Silence
+            Chip8.V[Chip8.HaltRegister] = i;
+            Chip8.Halted = false;
+            return false;
         }
     }
+    return true;
 }
 
-void Run()
+// Any Seed Works: It Is Scrambled First, So Nearby Seeds Give Unrelated Sequences (And Never The Stuck Zero State)
+void SeedRandom(uint64_t seed)
 {
-    // Setting RunTime Variables
-    SDL_Window *window;
-    SDL_Renderer *renderer;
-    SDL_Event event;
-    bool run = true;
-
-    SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
-
-    // Getting Screen Resolution
-    SDL_DisplayMode dm;
-    SDL_GetCurrentDisplayMode(0, &dm);
-    int SCREEN_WIDTH = 640;
-    int SCREEN_HEIGHT = 320;
-
-    // Uniform Scaling Cell According to Resolution
-    int CELL_WIDTH = SCREEN_WIDTH / GRID_WIDTH;
-    int CELL_HEIGHT = SCREEN_HEIGHT / GRID_HEIGHT;
-    int CELL_SIZE = (CELL_WIDTH > CELL_HEIGHT) ? CELL_HEIGHT : CELL_WIDTH;
+    uint64_t z = seed + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    Chip8.Random = (z != 0) ? z : 1;
+}
 
-    // Setting Window, Renderer & Audio
-    SDL_CreateWindowAndRenderer(SCREEN_WIDTH, SCREEN_HEIGHT, 0, &window, &renderer);
+// Next Byte For CXNN (Top Bits Of xorshift64*, No Shared libc State)
+uint8_t NextRandom()
+{
+    uint64_t x = Chip8.Random;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    Chip8.Random = x;
+    return (uint8_t)((x * 0x2545F4914F6CDD1DULL) >> 56);
+}
 
-    // Audio Setup
-    SDL_AudioSpec want, have;
-    SDL_zero(want);
-    want.freq = 44100;          // 44.1 kHz
-    want.format = AUDIO_F32SYS; // Float 32-bit audio
-    want.channels = 1;          // Mono
-    want.samples = 2048;
-    want.callback = AudioCallback;
-    SDL_PauseAudio(0);
+// Strict Memory: An Access Of `length` Bytes From address Must Stay Inside The 4K Space
+uint16_t CheckedAddress(unsigned int address, int length)
+{
+    if (address + length > MEMORY_SIZE)
+    {
+        fprintf(stderr, "Strict Memory: %d Byte Access At %04x Runs Past %04x (PC %04x)\n", length, address, MEMORY_SIZE - 1,
+                Chip8.PC);
+        abort();
+    }
+    return address;
+}
 
-    // Main Loop
-    while (run)
+// Strict Memory: More Than 16 Nested Calls
+uint8_t CheckedStack(unsigned int SP)
+{
+    if (SP > STACK_MASK)
     {
-        // Event Handling
-        while (SDL_PollEvent(&event))
-        {
-            if (event.type == SDL_QUIT)
-            {
-                run = false;
-            }
-
-            if (event.type == SDL_KEYDOWN)
-            {
-                switch (event.key.keysym.sym)
-                {
-                case SDLK_1:
-                    Chip8.Key[0x1] = 1;
-                    printf("Key 1 pressed\n");
-                    break;
-
-                case SDLK_2:
-                    Chip8.Key[0x2] = 1;
-                    printf("Key 2 pressed\n");
-                    break;
-
-                case SDLK_3:
-                    Chip8.Key[0x3] = 1;
-                    printf("Key 3 pressed\n");
-                    break;
-
-                case SDLK_4:
-                    Chip8.Key[0xC] = 1;
-                    printf("Key C pressed\n");
-                    break;
-
-                case SDLK_q:
-                    Chip8.Key[0x4] = 1;
-                    printf("Key 4 pressed\n");
-                    break;
-
-                case SDLK_w:
-                    Chip8.Key[0x5] = 1;
-                    printf("Key 5 pressed\n");
-                    break;
-
-                case SDLK_e:
-                    Chip8.Key[0x6] = 1;
-                    printf("Key 6 pressed\n");
-                    break;
-
-                case SDLK_r:
-                    Chip8.Key[0xD] = 1;
-                    printf("Key D pressed\n");
-                    break;
-
-                case SDLK_a:
-                    Chip8.Key[0x7] = 1;
-                    printf("Key 7 pressed\n");
-                    break;
-
-                case SDLK_s:
-                    Chip8.Key[0x8] = 1;
-                    printf("Key 8 pressed\n");
-                    break;
-
-                case SDLK_d:
-                    Chip8.Key[0x9] = 1;
-                    printf("Key 9 pressed\n");
-                    break;
-
-                case SDLK_f:
-                    Chip8.Key[0xE] = 1;
-                    printf("Key E pressed\n");
-                    break;
-
-                case SDLK_z:
-                    Chip8.Key[0xA] = 1;
-                    printf("Key A pressed\n");
-                    break;
-
-                case SDLK_x:
-                    Chip8.Key[0x0] = 1;
-                    printf("Key 0 pressed\n");
-                    break;
-
-                case SDLK_c:
-                    Chip8.Key[0xB] = 1;
-                    printf("Key B pressed\n");
-                    break;
-
-                case SDLK_v:
-                    Chip8.Key[0xF] = 1;
-                    printf("Key F pressed\n");
-                    break;
-
-                default:
-                    printf("Key Not For Emulator\n");
-                    break;
-                }
-            }
-
-            if (event.type == SDL_KEYUP)
-            {
-                switch (event.key.keysym.sym)
-                {
-                case SDLK_1:
-                    Chip8.Key[0x1] = 0;
-                    printf("Key 1 released\n");
-                    break;
-
-                case SDLK_2:
-                    Chip8.Key[0x2] = 0;
-                    printf("Key 2 released\n");
-                    break;
-
-                case SDLK_3:
-                    Chip8.Key[0x3] = 0;
-                    printf("Key 3 released\n");
-                    break;
-
-                case SDLK_4:
-                    Chip8.Key[0xC] = 0;
-                    printf("Key C released\n");
-                    break;
-
-                case SDLK_q:
-                    Chip8.Key[0x4] = 0;
-                    printf("Key 4 released\n");
-                    break;
-
-                case SDLK_w:
-                    Chip8.Key[0x5] = 0;
-                    printf("Key 5 released\n");
-                    break;
-
-                case SDLK_e:
-                    Chip8.Key[0x6] = 0;
-                    printf("Key 6 released\n");
-                    break;
-
-                case SDLK_r:
-                    Chip8.Key[0xD] = 0;
-                    printf("Key D released\n");
-                    break;
-
-                case SDLK_a:
-                    Chip8.Key[0x7] = 0;
-                    printf("Key 7 released\n");
-                    break;
-
-                case SDLK_s:
-                    Chip8.Key[0x8] = 0;
-                    printf("Key 8 released\n");
-                    break;
-
-                case SDLK_d:
-                    Chip8.Key[0x9] = 0;
-                    printf("Key 9 released\n");
-                    break;
-
-                case SDLK_f:
-                    Chip8.Key[0xE] = 0;
-                    printf("Key E released\n");
-                    break;
-
-                case SDLK_z:
-                    Chip8.Key[0xA] = 0;
-                    printf("Key A released\n");
-                    break;
-
-                case SDLK_x:
-                    Chip8.Key[0x0] = 0;
-                    printf("Key 0 released\n");
-                    break;
-
-                case SDLK_c:
-                    Chip8.Key[0xB] = 0;
-                    printf("Key B released\n");
-                    break;
-
-                case SDLK_v:
-                    Chip8.Key[0xF] = 0;
-                    printf("Key F released\n");
-                    break;
-
-                default:
-                    printf("Key Not For Emulator\n");
-                    break;
-                }
-            }
-        }
+        fprintf(stderr, "Strict Memory: Stack Overflow, Depth %u (PC %04x)\n", SP + 1, Chip8.PC);
+        abort();
+    }
+    return SP;
+}
 
-        // Clear Renderer
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+uint64_t HashBytes(uint64_t hash, const void *data, size_t length)
+{
+    const uint8_t *bytes = data;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
 
-        // Render Cells
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        for (int i = 0; i < GRID_WIDTH; i++)
-        {
-            for (int j = 0; j < GRID_HEIGHT; j++)
-            {
-                if (Chip8.Display[j * GRID_WIDTH + i] != 0)
-                {
-                    SDL_Rect cell = {i * CELL_SIZE, j * CELL_SIZE, CELL_SIZE, CELL_SIZE};
-                    SDL_RenderFillRect(renderer, &cell);
-                }
-            }
-        }
+// A Field Of size Bytes, Least Significant Byte First Whatever The Host's Byte Order
+static uint64_t HashLittleEndian(uint64_t hash, uint64_t value, int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        uint8_t byte = (uint8_t)(value >> (8 * i));
+        hash = HashBytes(hash, &byte, sizeof(byte));
+    }
+    return hash;
+}
 
-        SDL_RenderPresent(renderer);
+// FNV-1a Over Everything That Decides What Runs Next (Timers As The Current Instruction Sees Them)
+uint64_t StateHash()
+{
+    uint8_t delay = ReadTimer(&Chip8.Delay_Timer, Chip8.Cycles + 1);
+    uint8_t sound = ReadTimer(&Chip8.Sound_Timer, Chip8.Cycles + 1);
+    uint64_t hash = HASH_OFFSET_BASIS;
 
-        // Loop to Emulate Clock Cycle
-        for (int i = 0; i < 11; i++)
-        {
-            ExecuteInstructions();
-        }
+    hash = HashBytes(hash, Chip8.Memory, sizeof(Chip8.Memory));
 
-        // Timers
-        if (Chip8.Delay_Timer > 0)
-        {
-            Chip8.Delay_Timer--;
-            if (Chip8.Delay_Timer == 0)
-            {
-            }
-        }
-        if (Chip8.Sound_Timer > 0)
+    // Pixels One Byte Each, As Before The Display Was Packed, So Hashes Stay Comparable Across Versions. Wider
+    // Fields Go In Little Endian, So They Match Across Hosts Too
+    for (int y = 0; y < GRID_HEIGHT; y++)
+    {
+        for (int x = 0; x < GRID_WIDTH; x++)
         {
-            Chip8.Sound_Timer--;
+            uint8_t pixel = DISPLAY_PIXEL(x, y);
+            hash = HashBytes(hash, &pixel, sizeof(pixel));
         }
-        SDL_Delay(1000 / EMULATION_SPEED);
     }
-
-    SDL_CloseAudio();
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
-    SDL_Quit();
+    hash = HashLittleEndian(hash, Chip8.PC, sizeof(Chip8.PC));
+    hash = HashLittleEndian(hash, Chip8.I, sizeof(Chip8.I));
+    for (int i = 0; i < (int)(sizeof(Chip8.Stack) / sizeof(Chip8.Stack[0])); i++)
+    {
+        hash = HashLittleEndian(hash, Chip8.Stack[i], sizeof(Chip8.Stack[i]));
+    }
+    hash = HashBytes(hash, &Chip8.SP, sizeof(Chip8.SP));
+    hash = HashBytes(hash, &delay, sizeof(delay));
+    hash = HashBytes(hash, &sound, sizeof(sound));
+    hash = HashBytes(hash, Chip8.V, sizeof(Chip8.V));
+    hash = HashBytes(hash, Chip8.Key, sizeof(Chip8.Key));
+    hash = HashLittleEndian(hash, Chip8.Cycles, sizeof(Chip8.Cycles));
+    hash = HashBytes(hash, &Chip8.Halted, sizeof(Chip8.Halted));
+    hash = HashBytes(hash, &Chip8.HaltRegister, sizeof(Chip8.HaltRegister));
+    hash = HashLittleEndian(hash, Chip8.Random, sizeof(Chip8.Random));
+    return hash;
 }
 
-int main(int argc, char **argv)
+void ExecuteInstructions()
 {
-    if (argc > 2 || argc == 1)
+    // Halted Time Still Counts Towards The Timers
+    if (WaitingForKey())
     {
-        printf("Usage: %s <file_path_name> \n", argv[0]);
+        Chip8.Cycles++;
+        return;
+    }
+
+    DecodedInstruction *D;
+    DecodedInstruction Uncached;
+
+    // Fetch Predecoded Instruction (Last Byte Has No Full Opcode, Decode Directly)
+    if (Chip8.PC < MEMORY_SIZE - 1)
+    {
+        D = &DecodedMemory[Chip8.PC];
     }
     else
     {
-        InitializeChip8();
-        ClearDisplay();
+        DecodeInstruction(Chip8.PC, &Uncached);
+        D = &Uncached;
+    }
 
-        if (LoadROM(argv[1]) == 0)
-        {
-            Run();
-        }
+    // Update Program Counter
+    uint16_t PC = Chip8.PC;
+    Chip8.PC += 2;
+    Chip8.Cycles++;
+
+    // Dispatch, Recording Register Changes When Writing An Execution Trace
+    if (ExecTraceActive)
+    {
+        uint8_t V[16];
+        memcpy(V, Chip8.V, sizeof(V));
+        D->Handler(D);
+        ExecTraceInstruction(PC, D->Opcode, Chip8.I, Chip8.SP, V, Chip8.V, Chip8.Cycles);
+        return;
     }
-    return 0;
-}
\ No newline at end of file
+    D->Handler(D);
+}
+
+// Batched Interpreter, Specialized For The Active Quirk Profile (See QuirkVariant.h)
+CHIP8_STOP RunChip8(int instructions, int *executed)
+{
+    return Profile->Run(instructions, executed);
+}
@@ -0,0 +1,178 @@
+#ifndef CHIP8_H
+#define CHIP8_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define GRID_WIDTH 64
+#define GRID_HEIGHT 32
+#define MEMORY_SIZE 4096
+#define FONT_SIZE 80
+#define MEMORY_STARTING_ADDRESS 0x200
+
+// Display Rows Are Packed One Per uint64_t (GRID_WIDTH Must Stay 64), Pixel 0 In The Top Bit
+#define DISPLAY_PIXEL(X, Y) ((Chip8.Display[(Y)] >> (GRID_WIDTH - 1 - (X))) & 1)
+
+// Safe By Construction: Every Base Address Is Masked Into The 4K Space & The Stack Index Into 16 Entries,
+// With A Guard Behind Memory For The Up To 16 Bytes An Access Reads Or Writes From Its Base
+#define MEMORY_MASK (MEMORY_SIZE - 1)
+#define MEMORY_GUARD 16
+#define STACK_MASK 0xF
+
+// Strict Memory (Selected At Compile Time With -DSTRICT_MEMORY=1): Report & Abort Instead Of Masking
+#ifndef STRICT_MEMORY
+#define STRICT_MEMORY 0
+#endif
+
+#if STRICT_MEMORY
+#define MEMORY_ADDRESS(Address, Length) CheckedAddress((Address), (Length))
+#define STACK_INDEX(SP) CheckedStack(SP)
+#else
+#define MEMORY_ADDRESS(Address, Length) ((Address) & MEMORY_MASK)
+#define STACK_INDEX(SP) ((SP) & STACK_MASK)
+#endif
+#define INSTRUCTIONS_PER_FRAME 11
+#define DEFAULT_SEED 1
+#define HASH_OFFSET_BASIS 0xCBF29CE484222325ULL
+
+// Lazy 60Hz Timer: The Value It Was Set To & The Cycle It Was Set On, Read Back With ReadTimer
+typedef struct
+{
+    uint8_t Value;
+    uint64_t Cycle;
+
+} CHIP8_TIMER;
+
+typedef struct
+{
+    uint8_t Memory[MEMORY_SIZE + MEMORY_GUARD];
+    uint64_t Display[GRID_HEIGHT];
+    uint16_t PC;
+    uint16_t I;
+    uint16_t Stack[16];
+    uint8_t SP;
+    CHIP8_TIMER Delay_Timer;
+    CHIP8_TIMER Sound_Timer;
+    uint8_t V[16];
+    uint8_t Key[16];
+    uint64_t Cycles;
+
+    // Timers Tick Once Every TickCycles Instructions (One Frame), Counted From TickOrigin
+    uint32_t TickCycles;
+    uint64_t TickOrigin;
+
+    // FX0A Key Wait: Nothing Runs Until A Key Is Down, Which Then Goes Into V[HaltRegister]
+    bool Halted;
+    uint8_t HaltRegister;
+
+    // CXNN's xorshift64* State, Kept With The Machine So A Seed Replays The Same Numbers
+    uint64_t Random;
+
+} CHIP8_CPU;
+
+// Predecoded Instruction, One Per Memory Address
+typedef struct DecodedInstruction DecodedInstruction;
+typedef void (*OpcodeHandler)(DecodedInstruction *D);
+
+// Fused Sequence Starting Here, Returns The Number Of Instructions It Ran
+typedef int (*FusedHandler)(DecodedInstruction *D);
+
+struct DecodedInstruction
+{
+    OpcodeHandler Handler;
+    uint16_t Opcode;
+    uint16_t NNN;
+    uint8_t X;
+    uint8_t Y;
+    uint8_t N;
+    uint8_t NN;
+    FusedHandler Fused;
+    uint8_t FusedLength;
+    uint8_t IdleLoop;
+};
+
+// Why RunChip8 Returned
+typedef enum
+{
+    CHIP8_STOP_BUDGET,   // Ran Every Instruction It Was Given
+    CHIP8_STOP_DRAW,     // Just Executed DXYN
+    CHIP8_STOP_KEY_WAIT  // Halted On FX0A
+
+} CHIP8_STOP;
+
+extern CHIP8_CPU Chip8;
+
+// Sprites Drawn So Far (Every Tier Draws Through DrawSprite)
+extern uint64_t SpritesDrawn;
+
+// Display Rows Changed Since The Frontend Last Took Them (Bit N = Row N, GRID_HEIGHT Must Stay Within 32)
+extern uint32_t DisplayDirty;
+
+// Called After Every Write To Guest Memory (Used By Translated Code To Spot Self-Modification)
+extern void (*MemoryWriteHook)(int address, int length);
+
+// Decoded Program Image Alongside Chip8.Memory
+extern DecodedInstruction DecodedMemory[MEMORY_SIZE - 1];
+
+void InitializeChip8();
+void InitializeOpcodeTables();
+void ClearDisplay();
+void DrawSprite(uint8_t X, uint8_t Y, uint8_t N);
+bool LoadROM(const char *file);
+
+void DecodeInstruction(uint16_t address, DecodedInstruction *D);
+void InvalidateDecoded(int address, int length);
+uint8_t ReadTimer(const CHIP8_TIMER *Timer, uint64_t cycles);
+void WriteTimer(CHIP8_TIMER *Timer, uint8_t value, uint64_t cycles);
+uint64_t CyclesToNextTick(uint64_t cycles);
+void SetTickCycles(uint32_t tickCycles);
+bool WaitingForKey();
+void SeedRandom(uint64_t seed);
+uint8_t NextRandom();
+uint16_t CheckedAddress(unsigned int address, int length);
+uint8_t CheckedStack(unsigned int SP);
+uint64_t HashBytes(uint64_t hash, const void *data, size_t length);
+uint64_t StateHash();
+void ExecuteInstructions();
+CHIP8_STOP RunChip8(int instructions, int *executed);
+
+// Opcode Handlers
+void Op_Unknown(DecodedInstruction *D);
+void Op_Decode(DecodedInstruction *D);
+void Op_00E0(DecodedInstruction *D);
+void Op_00EE(DecodedInstruction *D);
+void Op_1NNN(DecodedInstruction *D);
+void Op_2NNN(DecodedInstruction *D);
+void Op_3XNN(DecodedInstruction *D);
+void Op_4XNN(DecodedInstruction *D);
+void Op_5XY0(DecodedInstruction *D);
+void Op_6XNN(DecodedInstruction *D);
+void Op_7XNN(DecodedInstruction *D);
+void Op_8XY0(DecodedInstruction *D);
+void Op_8XY1(DecodedInstruction *D);
+void Op_8XY2(DecodedInstruction *D);
+void Op_8XY3(DecodedInstruction *D);
+void Op_8XY4(DecodedInstruction *D);
+void Op_8XY5(DecodedInstruction *D);
+void Op_8XY6(DecodedInstruction *D);
+void Op_8XY7(DecodedInstruction *D);
+void Op_8XYE(DecodedInstruction *D);
+void Op_9XY0(DecodedInstruction *D);
+void Op_ANNN(DecodedInstruction *D);
+void Op_BNNN(DecodedInstruction *D);
+void Op_CXNN(DecodedInstruction *D);
+void Op_DXYN(DecodedInstruction *D);
+void Op_EX9E(DecodedInstruction *D);
+void Op_EXA1(DecodedInstruction *D);
+void Op_FX07(DecodedInstruction *D);
+void Op_FX0A(DecodedInstruction *D);
+void Op_FX15(DecodedInstruction *D);
+void Op_FX18(DecodedInstruction *D);
+void Op_FX1E(DecodedInstruction *D);
+void Op_FX29(DecodedInstruction *D);
+void Op_FX33(DecodedInstruction *D);
+void Op_FX55(DecodedInstruction *D);
+void Op_FX65(DecodedInstruction *D);
+
+#endif
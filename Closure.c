@@ -0,0 +1,420 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "CHIP8.h"
+#include "Trace.h"
+#include "Closure.h"
+#include "Quirks.h"
+
+bool ClosureActive = false;
+
+// Tuning
+#define CLOSURE_MAX_BLOCK 64
+#define CLOSURE_MAX_CHAIN 4
+
+// One Pre-Bound Step Of A Block
+typedef struct ClosureOp ClosureOp;
+typedef void (*ClosureHandler)(ClosureOp *Op);
+
+struct ClosureOp
+{
+    ClosureHandler Run;
+    DecodedInstruction D;
+
+    // Instructions Covered, More Than One When 8XY0 Chains Fold Into One Step
+    uint8_t Count;
+    uint8_t ChainX[CLOSURE_MAX_CHAIN];
+    uint8_t ChainY[CLOSURE_MAX_CHAIN];
+};
+
+typedef struct
+{
+    uint16_t End;
+    uint8_t Length;
+    uint8_t Count;
+    ClosureOp Ops[];
+
+} ClosureBlock;
+
+static ClosureBlock *Blocks[MEMORY_SIZE];
+
+// Number Of Built Blocks Covering Each Byte Of Memory
+static uint16_t Covered[MEMORY_SIZE];
+
+// Block Being Run, And Whether A Write Inside It Dropped It
+static ClosureBlock *Running = NULL;
+static bool RunningDropped = false;
+
+// Specialized Handlers (PC Already Points Past The Block, Only The Last Step May Change It)
+
+static void C_Generic(ClosureOp *Op)
+{
+    Op->D.Handler(&Op->D);
+}
+
+static void C_Load(ClosureOp *Op)
+{
+    Chip8.V[Op->D.X] = Op->D.NN;
+}
+
+static void C_Increment(ClosureOp *Op)
+{
+    Chip8.V[Op->D.X]++;
+}
+
+static void C_Add(ClosureOp *Op)
+{
+    Chip8.V[Op->D.X] += Op->D.NN;
+}
+
+static void C_Move(ClosureOp *Op)
+{
+    Chip8.V[Op->D.X] = Chip8.V[Op->D.Y];
+}
+
+static void C_MoveChain(ClosureOp *Op)
+{
+    for (int i = 0; i < Op->Count; i++)
+    {
+        Chip8.V[Op->ChainX[i]] = Chip8.V[Op->ChainY[i]];
+    }
+}
+
+static void C_Or(ClosureOp *Op)
+{
+    Chip8.V[Op->D.X] |= Chip8.V[Op->D.Y];
+}
+
+static void C_And(ClosureOp *Op)
+{
+    Chip8.V[Op->D.X] &= Chip8.V[Op->D.Y];
+}
+
+static void C_Xor(ClosureOp *Op)
+{
+    Chip8.V[Op->D.X] ^= Chip8.V[Op->D.Y];
+}
+
+static void C_SetI(ClosureOp *Op)
+{
+    Chip8.I = Op->D.NNN;
+}
+
+static void C_AddI(ClosureOp *Op)
+{
+    Chip8.I += Chip8.V[Op->D.X];
+}
+
+static void C_GetDelay(ClosureOp *Op)
+{
+    Chip8.V[Op->D.X] = ReadTimer(&Chip8.Delay_Timer, Chip8.Cycles);
+}
+
+static void C_SetDelay(ClosureOp *Op)
+{
+    WriteTimer(&Chip8.Delay_Timer, Chip8.V[Op->D.X], Chip8.Cycles);
+}
+
+static void C_Jump(ClosureOp *Op)
+{
+    Chip8.PC = Op->D.NNN;
+}
+
+static void C_SkipEqual(ClosureOp *Op)
+{
+    if (Chip8.V[Op->D.X] == Op->D.NN)
+    {
+        Chip8.PC += 2;
+    }
+}
+
+static void C_SkipNotEqual(ClosureOp *Op)
+{
+    if (Chip8.V[Op->D.X] != Op->D.NN)
+    {
+        Chip8.PC += 2;
+    }
+}
+
+// Instructions That Leave The Block: Control Flow, Memory Writes That May Hit The Block Itself,
+// Or Timer Accesses (Which Need Chip8.Cycles To Be Their Own Cycle, True Only For The Last Step)
+static bool EndsBlock(OpcodeHandler H)
+{
+    // Other Quirk Profiles Bring Their Own BNNN & FX55 Handlers
+    if (H == Profile->Jump || H == Profile->Store)
+    {
+        return true;
+    }
+    return H == Op_00EE || H == Op_1NNN || H == Op_2NNN || H == Op_3XNN || H == Op_4XNN || H == Op_5XY0 ||
+           H == Op_9XY0 || H == Op_BNNN || H == Op_EX9E || H == Op_EXA1 || H == Op_FX07 || H == Op_FX0A ||
+           H == Op_FX15 || H == Op_FX18 || H == Op_FX33 || H == Op_FX55;
+}
+
+static ClosureHandler Specialize(const DecodedInstruction *D)
+{
+    // Opcode Tracing Needs The Interpreter's Handlers
+#if TRACE_LEVEL < TRACE_LEVEL_OPCODES
+    OpcodeHandler H = D->Handler;
+
+    if (H == Op_6XNN)
+    {
+        return C_Load;
+    }
+    if (H == Op_7XNN)
+    {
+        return (D->NN == 1) ? C_Increment : C_Add;
+    }
+    if (H == Op_8XY0)
+    {
+        return C_Move;
+    }
+    if (H == Op_8XY1)
+    {
+        return C_Or;
+    }
+    if (H == Op_8XY2)
+    {
+        return C_And;
+    }
+    if (H == Op_8XY3)
+    {
+        return C_Xor;
+    }
+    if (H == Op_ANNN)
+    {
+        return C_SetI;
+    }
+    if (H == Op_FX1E)
+    {
+        return C_AddI;
+    }
+    if (H == Op_FX07)
+    {
+        return C_GetDelay;
+    }
+    if (H == Op_FX15)
+    {
+        return C_SetDelay;
+    }
+    if (H == Op_1NNN)
+    {
+        return C_Jump;
+    }
+    if (H == Op_3XNN)
+    {
+        return C_SkipEqual;
+    }
+    if (H == Op_4XNN)
+    {
+        return C_SkipNotEqual;
+    }
+#endif
+    return C_Generic;
+}
+
+static ClosureBlock *BuildBlock(uint16_t start)
+{
+    ClosureBlock *B = malloc(sizeof(ClosureBlock) + CLOSURE_MAX_BLOCK * sizeof(ClosureOp));
+    if (B == NULL)
+    {
+        return NULL;
+    }
+
+    uint16_t address = start;
+    int length = 0;
+    int count = 0;
+
+    while (length < CLOSURE_MAX_BLOCK && address < MEMORY_SIZE - 1)
+    {
+        DecodedInstruction D;
+        DecodeInstruction(address, &D);
+        address += 2;
+        length++;
+
+        ClosureHandler Run = Specialize(&D);
+        ClosureOp *Previous = (count > 0) ? &B->Ops[count - 1] : NULL;
+
+        if (Run == C_Move && Previous != NULL && Previous->Count < CLOSURE_MAX_CHAIN &&
+                 (Previous->Run == C_Move || Previous->Run == C_MoveChain))
+        {
+            // Extend An 8XY0 Chain
+            if (Previous->Run == C_Move)
+            {
+                Previous->Run = C_MoveChain;
+                Previous->Count = 1;
+                Previous->ChainX[0] = Previous->D.X;
+                Previous->ChainY[0] = Previous->D.Y;
+            }
+            Previous->ChainX[Previous->Count] = D.X;
+            Previous->ChainY[Previous->Count] = D.Y;
+            Previous->Count++;
+        }
+        else
+        {
+            ClosureOp *Op = &B->Ops[count++];
+            Op->Run = Run;
+            Op->D = D;
+            Op->Count = 1;
+        }
+
+        if (EndsBlock(D.Handler))
+        {
+            break;
+        }
+    }
+
+    B->End = address;
+    B->Length = length;
+    B->Count = count;
+
+    for (int i = start; i < B->End; i++)
+    {
+        Covered[i]++;
+    }
+    return B;
+}
+
+static int RunBlock(ClosureBlock *B, uint16_t start, int budget)
+{
+    ClosureOp *Op = B->Ops;
+
+    if (B->Length <= budget)
+    {
+        int length = B->Length;
+        Chip8.PC = B->End;
+        Chip8.Cycles += length;
+        ClosureOp *Last = Op + B->Count;
+
+        // A Block Ending In FX33/FX55 Can Overwrite Itself, It's Freed Once Its Last Step Returns
+        Running = B;
+        while (Op < Last)
+        {
+            Op->Run(Op);
+            Op++;
+        }
+        Running = NULL;
+
+        if (RunningDropped)
+        {
+            free(B);
+            RunningDropped = false;
+        }
+        return length;
+    }
+
+    // Budget Ends Mid-Block: Run The Steps That Fit, None Of Which Touch PC
+    int executed = 0;
+    while (executed + Op->Count <= budget)
+    {
+        Op->Run(Op);
+        executed += Op->Count;
+        Op++;
+    }
+    Chip8.PC = start + 2 * executed;
+    Chip8.Cycles += executed;
+    return executed;
+}
+
+void ClosureInitialize()
+{
+    ClosureActive = true;
+}
+
+void ClosureExecute(int instructions)
+{
+    while (instructions > 0 && !WaitingForKey())
+    {
+        uint16_t PC = Chip8.PC;
+
+        if (PC < MEMORY_SIZE - 1)
+        {
+            if (Blocks[PC] == NULL)
+            {
+                Blocks[PC] = BuildBlock(PC);
+            }
+
+            int executed = (Blocks[PC] != NULL) ? RunBlock(Blocks[PC], PC, instructions) : 0;
+            if (executed > 0)
+            {
+                instructions -= executed;
+                continue;
+            }
+        }
+
+        ExecuteInstructions();
+        instructions--;
+    }
+
+    // Halted Time Still Counts Towards The Timers
+    if (instructions > 0)
+    {
+        Chip8.Cycles += instructions;
+    }
+}
+
+void ClosureInvalidate(int address, int length)
+{
+    if (!ClosureActive)
+    {
+        return;
+    }
+
+    int end = address + length;
+    if (address < 0)
+    {
+        address = 0;
+    }
+    if (end > MEMORY_SIZE)
+    {
+        end = MEMORY_SIZE;
+    }
+
+    // Cheap Exit For Writes Outside Any Built Block
+    bool hit = false;
+    for (int i = address; i < end; i++)
+    {
+        if (Covered[i] != 0)
+        {
+            hit = true;
+            break;
+        }
+    }
+    if (!hit)
+    {
+        return;
+    }
+
+    // Drop Every Block Overlapping The Written Bytes
+    int first = address - 2 * CLOSURE_MAX_BLOCK;
+    for (int start = (first > 0) ? first : 0; start < end; start++)
+    {
+        ClosureBlock *B = Blocks[start];
+        if (B != NULL && B->End > address)
+        {
+            for (int i = start; i < B->End; i++)
+            {
+                Covered[i]--;
+            }
+            Blocks[start] = NULL;
+            if (B == Running)
+            {
+                RunningDropped = true;
+            }
+            else
+            {
+                free(B);
+            }
+        }
+    }
+}
+
+void ClosureShutdown()
+{
+    for (int i = 0; i < MEMORY_SIZE; i++)
+    {
+        free(Blocks[i]);
+        Blocks[i] = NULL;
+        Covered[i] = 0;
+    }
+    ClosureActive = false;
+}
@@ -0,0 +1,14 @@
+#ifndef CLOSURE_H
+#define CLOSURE_H
+
+#include <stdbool.h>
+
+// Portable Threaded-Code Tier: Basic Blocks As Arrays Of Specialized Handlers
+extern bool ClosureActive;
+
+void ClosureInitialize();
+void ClosureExecute(int instructions);
+void ClosureInvalidate(int address, int length);
+void ClosureShutdown();
+
+#endif
@@ -0,0 +1,319 @@
+#include <stdio.h>
+#include <string.h>
+#include "ExecTrace.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+// Size Of The Mapped Window, The File Grows One Window At A Time
+#define EXEC_TRACE_WINDOW (4 * 1024 * 1024)
+
+bool ExecTraceActive = false;
+
+// Previous Record State (Records Are Delta Encoded Against It)
+static uint16_t TracePrevPC;
+static uint16_t TracePrevI;
+static uint8_t TracePrevSP;
+static uint64_t TracePrevCycle;
+
+// Bytes Of Records Written After The Header
+static uint64_t TraceLength = 0;
+
+static void WriteTraceHeader(uint8_t *header)
+{
+    memcpy(header, EXEC_TRACE_MAGIC, 4);
+    header[4] = EXEC_TRACE_VERSION & 0xFF;
+    header[5] = EXEC_TRACE_VERSION >> 8;
+    header[6] = 0;
+    header[7] = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        header[8 + i] = (TraceLength >> (8 * i)) & 0xFF;
+    }
+}
+
+#ifndef _WIN32
+static int TraceFD = -1;
+static uint8_t *TraceWindow = NULL;
+static uint64_t TraceWindowOffset = 0;
+static size_t TraceWindowPos = 0;
+static long TracePageSize;
+
+// Keep The Stored Length Current So A Crashed Run Still Decodes (The Rest Of The Window Is Zeros)
+static void StoreTraceLength()
+{
+    uint8_t header[EXEC_TRACE_HEADER_SIZE];
+    WriteTraceHeader(header);
+    pwrite(TraceFD, header, sizeof(header), 0);
+}
+
+static bool MapTraceWindow(uint64_t position)
+{
+    // Map Must Start On A Page Boundary
+    TraceWindowOffset = position - (position % TracePageSize);
+    TraceWindowPos = position - TraceWindowOffset;
+
+    if (ftruncate(TraceFD, TraceWindowOffset + EXEC_TRACE_WINDOW) != 0)
+    {
+        return false;
+    }
+
+    TraceWindow = mmap(NULL, EXEC_TRACE_WINDOW, PROT_READ | PROT_WRITE, MAP_SHARED, TraceFD, TraceWindowOffset);
+    if (TraceWindow == MAP_FAILED)
+    {
+        TraceWindow = NULL;
+        return false;
+    }
+    return true;
+}
+
+static uint8_t *ReserveTrace(size_t bytes)
+{
+    // Nothing Mapped After The File Failed To Grow
+    if (TraceWindow == NULL)
+    {
+        return NULL;
+    }
+
+    // Roll Over To The Next Window When The Record Might Not Fit
+    if (TraceWindowPos + bytes > EXEC_TRACE_WINDOW)
+    {
+        uint64_t position = TraceWindowOffset + TraceWindowPos;
+        munmap(TraceWindow, EXEC_TRACE_WINDOW);
+        TraceWindow = NULL;
+        StoreTraceLength();
+
+        if (!MapTraceWindow(position))
+        {
+            printf("Execution Trace: Couldn't Extend Trace File, Tracing Stopped\n");
+            ExecTraceActive = false;
+            return NULL;
+        }
+    }
+    return TraceWindow + TraceWindowPos;
+}
+
+static void CommitTrace(size_t bytes)
+{
+    TraceWindowPos += bytes;
+    TraceLength += bytes;
+}
+#else
+// No mmap On Windows, Stage Records In A Buffer And Append With fwrite
+static FILE *TraceFile = NULL;
+static uint8_t TraceStage[64 * 1024];
+static size_t TraceStagePos = 0;
+
+static uint8_t *ReserveTrace(size_t bytes)
+{
+    if (TraceStagePos + bytes > sizeof(TraceStage))
+    {
+        fwrite(TraceStage, 1, TraceStagePos, TraceFile);
+        TraceStagePos = 0;
+    }
+    return TraceStage + TraceStagePos;
+}
+
+static void CommitTrace(size_t bytes)
+{
+    TraceStagePos += bytes;
+    TraceLength += bytes;
+}
+#endif
+
+bool ExecTraceOpen(const char *path)
+{
+    TracePrevPC = 0xFFFF;
+    TracePrevI = 0;
+    TracePrevSP = 0;
+    TracePrevCycle = 0;
+    TraceLength = 0;
+
+#ifndef _WIN32
+    TraceFD = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (TraceFD < 0)
+    {
+        printf("Execution Trace: Couldn't Open %s\n", path);
+        return false;
+    }
+
+    TracePageSize = sysconf(_SC_PAGESIZE);
+    if (!MapTraceWindow(0))
+    {
+        printf("Execution Trace: Couldn't Map %s\n", path);
+        close(TraceFD);
+        TraceFD = -1;
+        return false;
+    }
+#else
+    TraceFile = fopen(path, "wb");
+    if (TraceFile == NULL)
+    {
+        printf("Execution Trace: Couldn't Open %s\n", path);
+        return false;
+    }
+    TraceStagePos = 0;
+#endif
+
+    // Header Is Rewritten With The Final Length On Close (& Every Frame Before That When Mapped)
+    WriteTraceHeader(ReserveTrace(EXEC_TRACE_HEADER_SIZE));
+    CommitTrace(EXEC_TRACE_HEADER_SIZE);
+    TraceLength = 0;
+
+    ExecTraceActive = true;
+    return true;
+}
+
+void ExecTraceInstruction(uint16_t PC, uint16_t opcode, uint16_t I, uint8_t SP, const uint8_t *oldV, const uint8_t *newV, uint64_t cycle)
+{
+    uint8_t *record = ReserveTrace(EXEC_TRACE_MAX_RECORD);
+    if (record == NULL)
+    {
+        return;
+    }
+
+    uint8_t flags = 0;
+    size_t size = 1;
+
+    // PC, Only When Not Sequential
+    if (PC != (uint16_t)(TracePrevPC + 2))
+    {
+        flags |= EXEC_TRACE_PC;
+        record[size++] = PC & 0xFF;
+        record[size++] = PC >> 8;
+    }
+    TracePrevPC = PC;
+
+    // Opcode
+    record[size++] = opcode >> 8;
+    record[size++] = opcode & 0xFF;
+
+    // I & SP, Only When Changed
+    if (I != TracePrevI)
+    {
+        flags |= EXEC_TRACE_I;
+        record[size++] = I & 0xFF;
+        record[size++] = I >> 8;
+        TracePrevI = I;
+    }
+    if (SP != TracePrevSP)
+    {
+        flags |= EXEC_TRACE_SP;
+        record[size++] = SP;
+        TracePrevSP = SP;
+    }
+
+    // Changed V Registers
+    uint16_t mask = 0;
+    int changed = 0;
+    int last = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        if (oldV[i] != newV[i])
+        {
+            mask |= (1 << i);
+            changed++;
+            last = i;
+        }
+    }
+    if (changed == 1)
+    {
+        flags |= EXEC_TRACE_REG;
+        record[size++] = last;
+        record[size++] = newV[last];
+    }
+    else if (changed > 1)
+    {
+        flags |= EXEC_TRACE_REGS;
+        record[size++] = mask & 0xFF;
+        record[size++] = mask >> 8;
+        for (int i = 0; i < 16; i++)
+        {
+            if (mask & (1 << i))
+            {
+                record[size++] = newV[i];
+            }
+        }
+    }
+
+    // Cycle Stamp, Only When Delta Isn't 1
+    uint64_t delta = cycle - TracePrevCycle;
+    TracePrevCycle = cycle;
+    if (delta != 1)
+    {
+        flags |= EXEC_TRACE_CYCLE;
+        while (delta >= 0x80)
+        {
+            record[size++] = (delta & 0x7F) | 0x80;
+            delta >>= 7;
+        }
+        record[size++] = delta;
+    }
+
+    record[0] = flags;
+    CommitTrace(size);
+}
+
+void ExecTraceFrame()
+{
+    uint8_t *record = ReserveTrace(1);
+    if (record == NULL)
+    {
+        return;
+    }
+
+    record[0] = EXEC_TRACE_FRAME;
+    CommitTrace(1);
+
+#ifndef _WIN32
+    // Once A Frame, So A Run That Dies Loses At Most Its Last Frame
+    StoreTraceLength();
+#endif
+}
+
+void ExecTraceClose()
+{
+    // A Trace That Stopped Early (Its File Couldn't Grow) Is No Longer Active, But Its File Is Still Open
+#ifndef _WIN32
+    if (TraceFD < 0)
+    {
+        return;
+    }
+#else
+    if (TraceFile == NULL)
+    {
+        return;
+    }
+#endif
+    ExecTraceActive = false;
+
+#ifndef _WIN32
+    // Trim The Unused Tail Of The Window & Store Final Length
+    uint64_t end = TraceWindowOffset + TraceWindowPos;
+    if (TraceWindow != NULL)
+    {
+        munmap(TraceWindow, EXEC_TRACE_WINDOW);
+        TraceWindow = NULL;
+    }
+
+    StoreTraceLength();
+    ftruncate(TraceFD, end);
+    close(TraceFD);
+    TraceFD = -1;
+#else
+    fwrite(TraceStage, 1, TraceStagePos, TraceFile);
+    TraceStagePos = 0;
+
+    uint8_t header[EXEC_TRACE_HEADER_SIZE];
+    WriteTraceHeader(header);
+    fseek(TraceFile, 0, SEEK_SET);
+    fwrite(header, 1, sizeof(header), TraceFile);
+    fclose(TraceFile);
+    TraceFile = NULL;
+#endif
+
+    printf("Execution Trace: %llu Bytes Written\n", (unsigned long long)TraceLength);
+}
@@ -0,0 +1,43 @@
+#ifndef EXEC_TRACE_H
+#define EXEC_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Binary Execution Trace File Layout
+//
+// Header (16 Bytes): "C8TR", Version (u16), Reserved (u16), Record Bytes (u64)
+// Records: 1 Flag Byte, Then Only The Fields Named By The Flags (Little Endian)
+//
+//   EXEC_TRACE_FRAME   Frame Boundary Marker, No Other Fields
+//   EXEC_TRACE_PC      PC (2) - Omitted When PC == Previous PC + 2
+//                      Opcode (2, Big Endian As In Memory) - Always Present
+//   EXEC_TRACE_I       I (2) - Only When I Changed
+//   EXEC_TRACE_SP      SP (1) - Only When SP Changed
+//   EXEC_TRACE_REG     Register Index (1), Value (1) - Exactly One V Register Changed
+//   EXEC_TRACE_REGS    Register Mask (2), One Value Per Set Bit - Several Changed
+//   EXEC_TRACE_CYCLE   Cycle Delta (Varint) - Omitted When Delta == 1
+
+#define EXEC_TRACE_MAGIC "C8TR"
+#define EXEC_TRACE_VERSION 1
+#define EXEC_TRACE_HEADER_SIZE 16
+
+#define EXEC_TRACE_PC 0x01
+#define EXEC_TRACE_I 0x02
+#define EXEC_TRACE_SP 0x04
+#define EXEC_TRACE_REG 0x08
+#define EXEC_TRACE_REGS 0x10
+#define EXEC_TRACE_CYCLE 0x20
+#define EXEC_TRACE_FRAME 0x80
+
+// Largest Possible Record: Flags + PC + Opcode + I + SP + Mask + 16 Values + Varint
+#define EXEC_TRACE_MAX_RECORD (1 + 2 + 2 + 2 + 1 + 2 + 16 + 10)
+
+extern bool ExecTraceActive;
+
+bool ExecTraceOpen(const char *path);
+void ExecTraceInstruction(uint16_t PC, uint16_t opcode, uint16_t I, uint8_t SP, const uint8_t *oldV, const uint8_t *newV, uint64_t cycle);
+void ExecTraceFrame();
+void ExecTraceClose();
+
+#endif
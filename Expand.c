@@ -0,0 +1,269 @@
+#include <stdio.h>
+#include <string.h>
+#include "CHIP8.h"
+#include "Expand.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define EXPAND_X86 1
+#include <immintrin.h>
+#else
+#define EXPAND_X86 0
+#endif
+
+// A Kernel Turns A Line Of Packed Bits (Count A Multiple Of 32) Into Output Pixels
+typedef void (*BitsTo8)(const uint8_t *bits, int count, uint8_t on, uint8_t off, uint8_t *out);
+typedef void (*BitsTo32)(const uint8_t *bits, int count, uint32_t on, uint32_t off, uint32_t *out);
+
+typedef struct
+{
+    const char *Name;
+    BitsTo8 To8;
+    BitsTo32 To32;
+
+} EXPAND_KERNEL;
+
+static void BitsTo8Scalar(const uint8_t *bits, int count, uint8_t on, uint8_t off, uint8_t *out)
+{
+    for (int i = 0; i < count; i++)
+    {
+        out[i] = ((bits[i >> 3] >> (7 - (i & 7))) & 1) ? on : off;
+    }
+}
+
+static void BitsTo32Scalar(const uint8_t *bits, int count, uint32_t on, uint32_t off, uint32_t *out)
+{
+    for (int i = 0; i < count; i++)
+    {
+        out[i] = ((bits[i >> 3] >> (7 - (i & 7))) & 1) ? on : off;
+    }
+}
+
+#if EXPAND_X86
+
+// Each Source Byte Copied Into All 8 Bytes Of A 64-Bit Lane
+#define SPREAD_BYTE(B) ((long long)((B) * 0x0101010101010101ULL))
+
+// Lanes Select Lit Pixels By Testing Their Own Bit (Most Significant Bit Is The Leftmost Pixel), Then Pick on Or off
+__attribute__((target("sse2"))) static void BitsTo8Sse2(const uint8_t *bits, int count, uint8_t on, uint8_t off, uint8_t *out)
+{
+    const __m128i select = _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i lit = _mm_set1_epi8((char)on);
+    const __m128i unlit = _mm_set1_epi8((char)off);
+
+    for (int i = 0; i < count / 16; i++)
+    {
+        __m128i source = _mm_set_epi64x(SPREAD_BYTE(bits[2 * i + 1]), SPREAD_BYTE(bits[2 * i]));
+        __m128i mask = _mm_cmpeq_epi8(_mm_and_si128(source, select), select);
+        _mm_storeu_si128((__m128i *)(out + 16 * i), _mm_or_si128(_mm_and_si128(mask, lit), _mm_andnot_si128(mask, unlit)));
+    }
+}
+
+__attribute__((target("sse2"))) static void BitsTo32Sse2(const uint8_t *bits, int count, uint32_t on, uint32_t off, uint32_t *out)
+{
+    const __m128i high = _mm_set_epi32(0x10, 0x20, 0x40, 0x80);
+    const __m128i low = _mm_set_epi32(0x01, 0x02, 0x04, 0x08);
+    const __m128i lit = _mm_set1_epi32((int)on);
+    const __m128i unlit = _mm_set1_epi32((int)off);
+
+    for (int i = 0; i < count / 8; i++)
+    {
+        __m128i source = _mm_set1_epi32(bits[i]);
+        __m128i left = _mm_cmpeq_epi32(_mm_and_si128(source, high), high);
+        __m128i right = _mm_cmpeq_epi32(_mm_and_si128(source, low), low);
+        _mm_storeu_si128((__m128i *)(out + 8 * i), _mm_or_si128(_mm_and_si128(left, lit), _mm_andnot_si128(left, unlit)));
+        _mm_storeu_si128((__m128i *)(out + 8 * i + 4), _mm_or_si128(_mm_and_si128(right, lit), _mm_andnot_si128(right, unlit)));
+    }
+}
+
+__attribute__((target("avx2"))) static void BitsTo8Avx2(const uint8_t *bits, int count, uint8_t on, uint8_t off, uint8_t *out)
+{
+    const __m256i select = _mm256_set1_epi64x(0x0102040810204080LL);
+    const __m256i lit = _mm256_set1_epi8((char)on);
+    const __m256i unlit = _mm256_set1_epi8((char)off);
+
+    for (int i = 0; i < count / 32; i++)
+    {
+        __m256i source = _mm256_set_epi64x(SPREAD_BYTE(bits[4 * i + 3]), SPREAD_BYTE(bits[4 * i + 2]),
+                                           SPREAD_BYTE(bits[4 * i + 1]), SPREAD_BYTE(bits[4 * i]));
+        __m256i mask = _mm256_cmpeq_epi8(_mm256_and_si256(source, select), select);
+        _mm256_storeu_si256((__m256i *)(out + 32 * i), _mm256_blendv_epi8(unlit, lit, mask));
+    }
+}
+
+__attribute__((target("avx2"))) static void BitsTo32Avx2(const uint8_t *bits, int count, uint32_t on, uint32_t off, uint32_t *out)
+{
+    const __m256i select = _mm256_set_epi32(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    const __m256i lit = _mm256_set1_epi32((int)on);
+    const __m256i unlit = _mm256_set1_epi32((int)off);
+
+    for (int i = 0; i < count / 8; i++)
+    {
+        __m256i source = _mm256_set1_epi32(bits[i]);
+        __m256i mask = _mm256_cmpeq_epi32(_mm256_and_si256(source, select), select);
+        _mm256_storeu_si256((__m256i *)(out + 8 * i), _mm256_blendv_epi8(unlit, lit, mask));
+    }
+}
+
+#endif
+
+static const EXPAND_KERNEL Kernels[] = {
+#if EXPAND_X86
+    {"avx2", BitsTo8Avx2, BitsTo32Avx2},
+    {"sse2", BitsTo8Sse2, BitsTo32Sse2},
+#endif
+    {"scalar", BitsTo8Scalar, BitsTo32Scalar},
+};
+
+#define KERNEL_COUNT (int)(sizeof(Kernels) / sizeof(Kernels[0]))
+
+static const EXPAND_KERNEL *Kernel = NULL;
+
+static bool KernelSupported(const EXPAND_KERNEL *kernel)
+{
+#if EXPAND_X86
+    __builtin_cpu_init();
+    if (strcmp(kernel->Name, "avx2") == 0)
+    {
+        return __builtin_cpu_supports("avx2");
+    }
+    if (strcmp(kernel->Name, "sse2") == 0)
+    {
+        return __builtin_cpu_supports("sse2");
+    }
+#endif
+    return true;
+}
+
+// Best Supported Kernel, Picked On First Use
+static const EXPAND_KERNEL *ActiveKernel()
+{
+    for (int k = 0; Kernel == NULL; k++)
+    {
+        if (KernelSupported(&Kernels[k]))
+        {
+            Kernel = &Kernels[k];
+        }
+    }
+    return Kernel;
+}
+
+bool ExpandSelectKernel(const char *name)
+{
+    for (int k = 0; k < KERNEL_COUNT; k++)
+    {
+        if (strcmp(Kernels[k].Name, name) == 0 && KernelSupported(&Kernels[k]))
+        {
+            Kernel = &Kernels[k];
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *ExpandKernelName()
+{
+    return ActiveKernel()->Name;
+}
+
+// One Row Of words Packed Words As A Line Of Packed Bits, Each Pixel Repeated scale Times (words * scale * 8 Bytes)
+static void ScaleRow(const uint64_t *row, int words, int scale, uint8_t *line)
+{
+    if (scale == 1)
+    {
+        for (int w = 0; w < words; w++)
+        {
+            for (int shift = 56; shift >= 0; shift -= 8)
+            {
+                *line++ = (uint8_t)(row[w] >> shift);
+            }
+        }
+        return;
+    }
+
+    // Bits Pile Up At The Bottom Of pending & Leave From The Top A Byte At A Time
+    uint64_t run = (1ULL << scale) - 1;
+    uint64_t pending = 0;
+    int count = 0;
+    for (int x = 0; x < words * 64; x++)
+    {
+        pending = (pending << scale) | (((row[x / 64] >> (63 - x % 64)) & 1) ? run : 0);
+        count += scale;
+        while (count >= 8)
+        {
+            count -= 8;
+            *line++ = (uint8_t)(pending >> count);
+        }
+    }
+}
+
+// Where Each Output Line Starts (Built By Line), The scale - 1 Below The First Are Copies Of It
+#define EXPAND_ROWS(Bytes, Line)                                                    \
+    for (int y = first; y <= last; y++)                                             \
+    {                                                                               \
+        uint8_t *line = (uint8_t *)dest + (size_t)(y - first) * scale * pitch;      \
+        Line;                                                                       \
+        for (int copy = 1; copy < scale; copy++)                                    \
+        {                                                                           \
+            memcpy(line + (size_t)copy * pitch, line, (size_t)(Bytes));             \
+        }                                                                           \
+    }
+
+void ExpandRows1(const uint64_t *rows, int words, int first, int last, int scale, void *dest, int pitch)
+{
+    EXPAND_ROWS(words * scale * 8, ScaleRow(rows + y * words, words, scale, line))
+}
+
+void ExpandRows8(const uint64_t *rows, int words, int first, int last, int scale, uint8_t on, uint8_t off, void *dest,
+                 int pitch)
+{
+    const EXPAND_KERNEL *kernel = ActiveKernel();
+    uint8_t bits[EXPAND_MAX_WIDTH / 8];
+    EXPAND_ROWS(words * 64 * scale, ScaleRow(rows + y * words, words, scale, bits);
+                kernel->To8(bits, words * 64 * scale, on, off, line))
+}
+
+void ExpandRows32(const uint64_t *rows, int words, int first, int last, int scale, uint32_t on, uint32_t off,
+                  void *dest, int pitch)
+{
+    const EXPAND_KERNEL *kernel = ActiveKernel();
+    uint8_t bits[EXPAND_MAX_WIDTH / 8];
+    EXPAND_ROWS(words * 64 * scale * 4, ScaleRow(rows + y * words, words, scale, bits);
+                kernel->To32(bits, words * 64 * scale, on, off, (uint32_t *)line))
+}
+
+// Shades Have No Bits To Test, So Lines Are A Plain Lookup: Only One Line In scale Is Built This Way
+static void ShadeLine8(const uint8_t *shades, int width, int scale, const uint8_t *palette, uint8_t *line)
+{
+    for (int x = 0; x < width; x++)
+    {
+        uint8_t pixel = palette[shades[x]];
+        for (int copy = 0; copy < scale; copy++)
+        {
+            *line++ = pixel;
+        }
+    }
+}
+
+static void ShadeLine32(const uint8_t *shades, int width, int scale, const uint32_t *palette, uint32_t *line)
+{
+    for (int x = 0; x < width; x++)
+    {
+        uint32_t pixel = palette[shades[x]];
+        for (int copy = 0; copy < scale; copy++)
+        {
+            *line++ = pixel;
+        }
+    }
+}
+
+void ExpandShades8(const uint8_t *shades, int width, int first, int last, int scale, const uint8_t *palette, void *dest,
+                   int pitch)
+{
+    EXPAND_ROWS(width * scale, ShadeLine8(shades + y * width, width, scale, palette, line))
+}
+
+void ExpandShades32(const uint8_t *shades, int width, int first, int last, int scale, const uint32_t *palette,
+                    void *dest, int pitch)
+{
+    EXPAND_ROWS(width * scale * 4, ShadeLine32(shades + y * width, width, scale, palette, (uint32_t *)line))
+}
@@ -0,0 +1,34 @@
+#ifndef EXPAND_H
+#define EXPAND_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Largest Integer Scale The Expansion Kernels Take For The Display, & The Widest Output Line That Makes
+#define EXPAND_MAX_SCALE 32
+#define EXPAND_MAX_WIDTH (64 * EXPAND_MAX_SCALE)
+
+// 1-Bit Rows first..last, words uint64_t Each (Packed As In Chip8.Display, So The Display Is words = 1), Expanded At
+// scale x scale Output Pixels Each Into dest, Which Holds Row first's Output, scale Lines Per Row, Each pitch Bytes
+// Apart. Lines Are Written Left To Right, At Most EXPAND_MAX_WIDTH Pixels:
+//
+//   ExpandRows1    Packed Bits, Most Significant First (PBM Order), Lit = 1
+//   ExpandRows8    One Byte Per Pixel (Palette Index Or Grey Level)
+//   ExpandRows32   One 32-Bit Word Per Pixel In Whatever Packing on & off Are Given In (RGBA8888, ARGB8888, ...)
+void ExpandRows1(const uint64_t *rows, int words, int first, int last, int scale, void *dest, int pitch);
+void ExpandRows8(const uint64_t *rows, int words, int first, int last, int scale, uint8_t on, uint8_t off, void *dest,
+                 int pitch);
+void ExpandRows32(const uint64_t *rows, int words, int first, int last, int scale, uint32_t on, uint32_t off,
+                  void *dest, int pitch);
+
+// The Same For Rows Of width Shades (One Byte Per Pixel, An Index Into palette), As The Smoothing Upscaler Gives
+void ExpandShades8(const uint8_t *shades, int width, int first, int last, int scale, const uint8_t *palette, void *dest,
+                   int pitch);
+void ExpandShades32(const uint8_t *shades, int width, int first, int last, int scale, const uint32_t *palette,
+                    void *dest, int pitch);
+
+// Kernels Are Picked By What The Host CPU Supports (avx2, sse2, scalar), Or Forced By Name For Comparison
+bool ExpandSelectKernel(const char *name);
+const char *ExpandKernelName();
+
+#endif
@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include "CHIP8.h"
+#include "Trace.h"
+#include "Fusion.h"
+#include "Quirks.h"
+
+uint32_t FusionSites[FUSION_KINDS];
+uint64_t FusionFired[FUSION_KINDS];
+
+const char *FusionNames[FUSION_KINDS] = {
+    "6XNN 6YNN [6ZNN]",
+    "ANNN DXYN",
+    "FX1E FX65",
+    "ANNN FX1E FX65",
+    "3XNN 1NNN",
+    "4XNN 1NNN"};
+
+// Fused Handlers: D Is The First Instruction, The Next Ones Are At D + 2 & D + 4. Draws & Loads Go Through
+// The Active Profile, Whose Clip & Index Quirks They Decoded With
+
+static int F_Loads(DecodedInstruction *D)
+{
+    int length = D->FusedLength;
+    for (int i = 0; i < length; i++)
+    {
+        Chip8.V[D[2 * i].X] = D[2 * i].NN;
+    }
+    Chip8.PC += 2 * length;
+    FusionFired[FUSION_LOADS]++;
+    return length;
+}
+
+static int F_SetIDraw(DecodedInstruction *D)
+{
+    Chip8.PC += 4;
+    Chip8.I = D->NNN;
+    Profile->Draw(D + 2);
+    FusionFired[FUSION_SET_I_DRAW]++;
+    return 2;
+}
+
+static int F_AddILoad(DecodedInstruction *D)
+{
+    Chip8.PC += 4;
+    Chip8.I += Chip8.V[D->X];
+    Profile->Load(D + 2);
+    FusionFired[FUSION_ADD_I_LOAD]++;
+    return 2;
+}
+
+static int F_IndexedLoad(DecodedInstruction *D)
+{
+    Chip8.PC += 6;
+    Chip8.I = D->NNN + Chip8.V[D[2].X];
+    Profile->Load(D + 4);
+    FusionFired[FUSION_INDEXED_LOAD]++;
+    return 3;
+}
+
+// Skip Taken Steps Over The Jump (1 Instruction), Otherwise The Jump Runs (2 Instructions)
+static int F_SkipEqualJump(DecodedInstruction *D)
+{
+    FusionFired[FUSION_SKIP_EQ_JUMP]++;
+    if (Chip8.V[D->X] == D->NN)
+    {
+        Chip8.PC += 4;
+        return 1;
+    }
+    Chip8.PC = D[2].NNN;
+    return 2;
+}
+
+static int F_SkipNotEqualJump(DecodedInstruction *D)
+{
+    FusionFired[FUSION_SKIP_NE_JUMP]++;
+    if (Chip8.V[D->X] != D->NN)
+    {
+        Chip8.PC += 4;
+        return 1;
+    }
+    Chip8.PC = D[2].NNN;
+    return 2;
+}
+
+static void Fuse(DecodedInstruction *D, FusedHandler Fused, int length, int kind)
+{
+    D->Fused = Fused;
+    D->FusedLength = length;
+    FusionSites[kind]++;
+}
+
+// Load-Time Pass: Decode The Range & Mark The Start Of Every Known Idiom
+void FuseInstructions(int address, int length)
+{
+    // Opcode Tracing Needs Every Instruction To Go Through Its Own Handler
+#if TRACE_LEVEL < TRACE_LEVEL_OPCODES
+    int end = address + length;
+    if (end > MEMORY_SIZE - 1)
+    {
+        end = MEMORY_SIZE - 1;
+    }
+
+    for (int i = address; i < end; i++)
+    {
+        DecodeInstruction(i, &DecodedMemory[i]);
+    }
+
+    // Every Address Is Decoded (Jumps Can Land Anywhere), But Only Instruction Boundaries From The Load
+    // Address Are Fusion Sites: Odd Ones Straddle Two Instructions Or Sit In Sprite Data
+    for (int i = address; i + 2 < end; i += 2)
+    {
+        DecodedInstruction *D = &DecodedMemory[i];
+        OpcodeHandler First = D[0].Handler;
+        OpcodeHandler Second = D[2].Handler;
+        OpcodeHandler Third = (i + 4 < end) ? D[4].Handler : NULL;
+
+        if (First == Op_6XNN && Second == Op_6XNN)
+        {
+            Fuse(D, F_Loads, (Third == Op_6XNN) ? 3 : 2, FUSION_LOADS);
+        }
+        else if (First == Op_ANNN && Second == Op_FX1E && Third == Profile->Load)
+        {
+            Fuse(D, F_IndexedLoad, 3, FUSION_INDEXED_LOAD);
+        }
+        else if (First == Op_ANNN && Second == Profile->Draw)
+        {
+            Fuse(D, F_SetIDraw, 2, FUSION_SET_I_DRAW);
+        }
+        else if (First == Op_FX1E && Second == Profile->Load)
+        {
+            Fuse(D, F_AddILoad, 2, FUSION_ADD_I_LOAD);
+        }
+        else if (First == Op_3XNN && Second == Op_1NNN)
+        {
+            Fuse(D, F_SkipEqualJump, 2, FUSION_SKIP_EQ_JUMP);
+        }
+        else if (First == Op_4XNN && Second == Op_1NNN)
+        {
+            Fuse(D, F_SkipNotEqualJump, 2, FUSION_SKIP_NE_JUMP);
+        }
+    }
+#endif
+}
+
+void FusionReport()
+{
+    printf("Fusion Statistics\n");
+    printf("%-18s %8s %12s\n", "Sequence", "Sites", "Fired");
+    for (int k = 0; k < FUSION_KINDS; k++)
+    {
+        printf("%-18s %8u %12llu\n", FusionNames[k], FusionSites[k], (unsigned long long)FusionFired[k]);
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef FUSION_H
+#define FUSION_H
+
+#include <stdint.h>
+
+// Superinstructions: Common Opcode Pairs & Triples Run As One Handler
+enum
+{
+    FUSION_LOADS,         // 6XNN 6YNN [6ZNN]
+    FUSION_SET_I_DRAW,    // ANNN DXYN
+    FUSION_ADD_I_LOAD,    // FX1E FX65
+    FUSION_INDEXED_LOAD,  // ANNN FX1E FX65
+    FUSION_SKIP_EQ_JUMP,  // 3XNN 1NNN
+    FUSION_SKIP_NE_JUMP,  // 4XNN 1NNN
+    FUSION_KINDS
+};
+
+// Fusion Sites Found At Load & Times Each Kind Ran
+extern uint32_t FusionSites[FUSION_KINDS];
+extern uint64_t FusionFired[FUSION_KINDS];
+
+void FuseInstructions(int address, int length);
+void FusionReport();
+
+#endif
@@ -0,0 +1,366 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "CHIP8.h"
+#include "ExecTrace.h"
+#include "Fusion.h"
+#include "Idle.h"
+#include "Vip.h"
+#include "Quirks.h"
+#include "InputLog.h"
+#include "Runner.h"
+#include "Expand.h"
+#include "Upscale.h"
+
+// Runs A ROM Without A Window, Audio Or Real Time: Frames Follow Each Other As Fast As The Host Goes,
+// With Keys From An Input Log, Then Prints The State Hash (The Same One CHIP8 -d Prints)
+
+typedef struct
+{
+    const char *ROM;
+    const char *ExecTraceFile;
+    const char *Profile;
+    const char *ReplayFile;
+    const char *DumpFile;
+    const char *Kernel;
+    const char *Upscaler;
+    uint64_t Frames;
+    uint64_t DumpEvery;
+    uint64_t Seed;
+    int Scale;
+    bool Jit;
+    bool JitVerify;
+    bool Closure;
+    bool Vip;
+    bool Stats;
+
+} HEADLESS_OPTIONS;
+
+HEADLESS_OPTIONS Options;
+
+// The Virtual Clock: Frames Run So Far
+uint64_t Frames = 0;
+
+// Dump Path For A Frame: The Dump File Itself, Or With "-<Frame>" Before Its Extension When Dumping Every N
+void DumpPath(char *path, size_t size, uint64_t frame)
+{
+    if (Options.DumpEvery == 0)
+    {
+        snprintf(path, size, "%s", Options.DumpFile);
+        return;
+    }
+
+    const char *extension = strrchr(Options.DumpFile, '.');
+    int stem = (extension != NULL) ? (int)(extension - Options.DumpFile) : (int)strlen(Options.DumpFile);
+    snprintf(path, size, "%.*s-%06llu%s", stem, Options.DumpFile, (unsigned long long)frame,
+             (extension != NULL) ? extension : "");
+}
+
+// The Display Through The -u Filter, & One Expanded Frame At The Largest Size, A Byte Per Pixel
+static UPSCALE_IMAGE Upscaled;
+static uint8_t DumpPixels[GRID_WIDTH * EXPAND_MAX_SCALE * GRID_HEIGHT * EXPAND_MAX_SCALE];
+
+// PGM (Grey) Or PPM (Colour) From The Dump's Extension, Otherwise PBM
+void DumpFormat(const char *path, bool *grey, bool *colour)
+{
+    const char *extension = strrchr(path, '.');
+    *grey = extension != NULL && strcmp(extension, ".pgm") == 0;
+    *colour = extension != NULL && strcmp(extension, ".ppm") == 0;
+}
+
+// The Display (Filtered By -u) At -x Scale As A Binary PBM (Lit Pixels Are 1, Black Ink) Or, For A .pgm / .ppm
+// Name, A PGM / PPM Drawn Like The Window
+bool DumpFrame(uint64_t frame)
+{
+    char path[1024];
+    DumpPath(path, sizeof(path), frame);
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        printf("Frame Dump: Couldn't Open %s\n", path);
+        return false;
+    }
+
+    UpscaleDisplay(Chip8.Display, &Upscaled);
+    int width = Upscaled.Width * Options.Scale;
+    int height = Upscaled.Height * Options.Scale;
+    bool grey, colour;
+    DumpFormat(path, &grey, &colour);
+
+    if (grey || colour)
+    {
+        UpscaleExpand8(&Upscaled, Options.Scale, 255, 0, DumpPixels, width);
+        fprintf(file, "%s\n%d %d\n255\n", grey ? "P5" : "P6", width, height);
+        if (grey)
+        {
+            fwrite(DumpPixels, 1, (size_t)width * height, file);
+        }
+        else
+        {
+            // White On Black, So Each Grey Level Goes Out Three Times
+            uint8_t line[GRID_WIDTH * EXPAND_MAX_SCALE * 3];
+            for (int y = 0; y < height; y++)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    memset(line + 3 * x, DumpPixels[y * width + x], 3);
+                }
+                fwrite(line, 1, (size_t)width * 3, file);
+            }
+        }
+    }
+    else
+    {
+        // Rows Packed 8 Pixels To A Byte, Most Significant Bit First, Which Is The Display Row's Own Order
+        ExpandRows1(Upscaled.Bits, Upscaled.Words, 0, Upscaled.Height - 1, Options.Scale, DumpPixels, width / 8);
+        fprintf(file, "P4\n%d %d\n", width, height);
+        fwrite(DumpPixels, 1, (size_t)width / 8 * height, file);
+    }
+
+    fclose(file);
+    return true;
+}
+
+// Whole Frames Back To Back. Keys Only Change Between Frames (From The Log), So Nothing Depends On Host Time
+bool Run()
+{
+    while (Options.Frames == 0 || Frames < Options.Frames)
+    {
+        // A Replay Ends On The Frame Its Recording Stopped On
+        if (!InputLogFrame(Frames))
+        {
+            break;
+        }
+        if (ExecTraceActive)
+        {
+            ExecTraceFrame();
+        }
+
+        RunInstructions(INSTRUCTIONS_PER_FRAME);
+        Frames++;
+
+        if (Options.DumpFile != NULL && Options.DumpEvery != 0 && Frames % Options.DumpEvery == 0 && !DumpFrame(Frames))
+        {
+            return false;
+        }
+    }
+
+    // Without -e The Dump Is The Last Frame Only
+    return Options.DumpFile == NULL || Options.DumpEvery != 0 || DumpFrame(Frames);
+}
+
+bool ParseArguments(int argc, char **argv)
+{
+    Options.ROM = NULL;
+    Options.ExecTraceFile = NULL;
+    Options.Profile = NULL;
+    Options.ReplayFile = NULL;
+    Options.DumpFile = NULL;
+    Options.Kernel = NULL;
+    Options.Upscaler = NULL;
+    Options.Frames = 0;
+    Options.DumpEvery = 0;
+    Options.Seed = DEFAULT_SEED;
+    Options.Scale = 1;
+    Options.Jit = false;
+    Options.JitVerify = false;
+    Options.Closure = false;
+    Options.Vip = false;
+    Options.Stats = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        // -n <frames> - Frames To Run (Without It, Until The Input Log Ends)
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+        {
+            Options.Frames = strtoull(argv[++i], NULL, 0);
+        }
+
+        // -p <file> - Keys From An Input Log Recorded With CHIP8 -r (Its Seed Replaces -d)
+        else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+        {
+            Options.ReplayFile = argv[++i];
+        }
+
+        // -d <seed> - CXNN Seed
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+        {
+            Options.Seed = strtoull(argv[++i], NULL, 0);
+        }
+
+        // -o <file> - Dump The Last Frame (.pgm For PGM, .ppm For PPM, Anything Else PBM)
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            Options.DumpFile = argv[++i];
+        }
+
+        // -e <frames> - Dump Every N Frames Instead, Numbered file-<frame>.pbm
+        else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+        {
+            Options.DumpEvery = strtoull(argv[++i], NULL, 0);
+        }
+
+        // -x <scale> - Dump Each Pixel As A scale x scale Block
+        else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc)
+        {
+            Options.Scale = atoi(argv[++i]);
+        }
+
+        // -u <filter> - Upscale Dumps First (scale2x, scale3x, scale4x, smooth), -x Then Scales The Result
+        else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc)
+        {
+            Options.Upscaler = argv[++i];
+        }
+
+        // -k <kernel> - Expansion Kernel For Dumps (avx2, sse2, scalar), Instead Of The Best The CPU Has
+        else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc)
+        {
+            Options.Kernel = argv[++i];
+        }
+
+        // -b <file> - Write Binary Execution Trace
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+        {
+            Options.ExecTraceFile = argv[++i];
+        }
+
+        // -j / -J / -c / -v / -q <profile> - Tier & Quirks, As For CHIP8
+        else if (strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "-J") == 0)
+        {
+            Options.Jit = true;
+            Options.JitVerify = (argv[i][1] == 'J');
+        }
+        else if (strcmp(argv[i], "-c") == 0)
+        {
+            Options.Closure = true;
+        }
+        else if (strcmp(argv[i], "-v") == 0)
+        {
+            Options.Vip = true;
+        }
+        else if (strcmp(argv[i], "-q") == 0 && i + 1 < argc)
+        {
+            Options.Profile = argv[++i];
+        }
+
+        // -s - Report Speed, Fused Sequences & Elided Idle Cycles
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            Options.Stats = true;
+        }
+
+        // ROM Path (Only One Allowed)
+        else if (argv[i][0] != '-' && Options.ROM == NULL)
+        {
+            Options.ROM = argv[i];
+        }
+
+        else
+        {
+            return false;
+        }
+    }
+
+    // Something Has To End The Run
+    return Options.ROM != NULL && (Options.Frames != 0 || Options.ReplayFile != NULL) &&
+           (Options.DumpEvery == 0 || Options.DumpFile != NULL) && Options.Scale >= 1 &&
+           Options.Scale <= EXPAND_MAX_SCALE;
+}
+
+int main(int argc, char **argv)
+{
+    if (!ParseArguments(argc, argv))
+    {
+        printf("Usage: %s -n <frames> | -p <input_log> [-d <seed>] [-o <dump.pbm | dump.pgm | dump.ppm> [-e <frames>] [-x <scale>] [-u <filter>] [-k <kernel>]] [-b <trace_file>] "
+               "[-s] [-j | -J | -c | -v] [-q <profile>] <file_path_name>\n",
+               argv[0]);
+        return 1;
+    }
+    if (Options.Profile != NULL && !SelectProfile(Options.Profile))
+    {
+        printf("Unknown Quirk Profile: %s (retro8, vip, chip48, schip, xochip)\n", Options.Profile);
+        return 1;
+    }
+    if (Options.Kernel != NULL && !ExpandSelectKernel(Options.Kernel))
+    {
+        printf("Unknown Or Unsupported Expansion Kernel: %s (avx2, sse2, scalar)\n", Options.Kernel);
+        return 1;
+    }
+
+    if (Options.Upscaler != NULL && !SelectUpscaler(Options.Upscaler))
+    {
+        printf("Unknown Upscaler: %s (scale2x, scale3x, scale4x, smooth)\n", Options.Upscaler);
+        return 1;
+    }
+    if (Upscaler != NULL && Upscaler->Factor * Options.Scale > EXPAND_MAX_SCALE)
+    {
+        printf("Frame Dump: %s At %dx Is Wider Than %d Pixels\n", Upscaler->Name, Options.Scale, EXPAND_MAX_WIDTH);
+        return 1;
+    }
+
+    // Shades Don't Fit In One Bit
+    bool grey, colour;
+    DumpFormat((Options.DumpFile != NULL) ? Options.DumpFile : "", &grey, &colour);
+    if (Upscaler != NULL && Upscaler->Shaded && Options.DumpFile != NULL && !grey && !colour)
+    {
+        printf("Frame Dump: %s Needs A .pgm Or .ppm Dump\n", Upscaler->Name);
+        return 1;
+    }
+
+    InitializeChip8();
+    InitializeOpcodeTables();
+    ClearDisplay();
+
+    if (LoadROM(Options.ROM) != 0)
+    {
+        return 1;
+    }
+    if (Options.ReplayFile != NULL && !InputLogOpen(Options.ReplayFile, true, &Options.Seed))
+    {
+        return 1;
+    }
+    SeedRandom(Options.Seed);
+
+    if (Options.ExecTraceFile != NULL)
+    {
+        ExecTraceOpen(Options.ExecTraceFile);
+    }
+    StartTier(Options.Vip, Options.Jit, Options.JitVerify, Options.Closure);
+
+    clock_t start = clock();
+    bool dumped = Run();
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    InputLogClose(Frames);
+    StopTier();
+    ExecTraceClose();
+
+    printf("State Hash: %016llx After %llu Frames (Seed %llu)\n", (unsigned long long)StateHash(),
+           (unsigned long long)Frames, (unsigned long long)Options.Seed);
+
+    if (Options.Stats)
+    {
+        if (seconds > 0)
+        {
+            printf("Speed: %llu Frames In %.3f s CPU, %.1fx Real Time\n", (unsigned long long)Frames, seconds,
+                   Frames / 60.0 / seconds);
+        }
+        if (Options.DumpFile != NULL)
+        {
+            printf("Frame Dumps: %s, %dx Scale, %s Expansion\n", (Upscaler != NULL) ? Upscaler->Name : "Unfiltered",
+                   Options.Scale, ExpandKernelName());
+        }
+        FusionReport();
+        printf("Idle Loops: %llu Cycles Elided\n", (unsigned long long)IdleCyclesElided);
+        if (VipActive)
+        {
+            printf("VIP Timing: %llu Instructions In %llu Machine Cycles\n", (unsigned long long)VipInstructions,
+                   (unsigned long long)Chip8.Cycles);
+        }
+    }
+    return dumped ? 0 : 1;
+}
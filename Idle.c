@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include "CHIP8.h"
+#include "Trace.h"
+#include "Idle.h"
+
+uint64_t IdleCyclesElided = 0;
+
+// Load-Time Pass Over Already Decoded Memory (FuseInstructions Decodes The Range)
+void FindIdleLoops(int address, int length)
+{
+    // Opcode Tracing Needs Every Instruction To Run
+#if TRACE_LEVEL < TRACE_LEVEL_OPCODES
+    int end = address + length;
+    if (end > MEMORY_SIZE - 1)
+    {
+        end = MEMORY_SIZE - 1;
+    }
+
+    // Instruction Boundaries From The Load Address, As For Fusion Sites
+    for (int i = address; i < end; i += 2)
+    {
+        DecodedInstruction *D = &DecodedMemory[i];
+
+        if (D[0].Handler == Op_1NNN && D[0].NNN == i)
+        {
+            D->IdleLoop = IDLE_JUMP_SELF;
+        }
+        else if (i + 4 < end && D[0].Handler == Op_FX07 && D[2].Handler == Op_3XNN && D[2].X == D[0].X &&
+                 D[4].Handler == Op_1NNN && D[4].NNN == i)
+        {
+            D->IdleLoop = IDLE_TIMER_POLL;
+        }
+    }
+#endif
+}
+
+// Consume As Much Of The Budget As Can Pass Without Executing, Up To Where The Polled Timer Reaches NN
+int SkipIdleLoop(DecodedInstruction *D, int instructions)
+{
+    if (D->IdleLoop == IDLE_TIMER_POLL)
+    {
+        // Loop Exits Once Delay_Timer == NN, Which Only Counting Down From Above NN Can Bring
+        uint8_t value = ReadTimer(&Chip8.Delay_Timer, Chip8.Cycles + 1);
+        if (value == D[2].NN)
+        {
+            return 0;
+        }
+        if (value > D[2].NN)
+        {
+            uint64_t until = CyclesToNextTick(Chip8.Cycles) + (uint64_t)(value - D[2].NN - 1) * Chip8.TickCycles;
+            if (until < (uint64_t)instructions)
+            {
+                instructions = (int)until;
+            }
+        }
+
+        // End Where Running It Would Have: V[X] From The Last FX07, PC Somewhere In The 3 Instruction Loop
+        uint64_t last = Chip8.Cycles + 1 + 3 * ((instructions - 1) / 3);
+        Chip8.V[D->X] = ReadTimer(&Chip8.Delay_Timer, last);
+        Chip8.PC += 2 * (instructions % 3);
+    }
+
+    Chip8.Cycles += instructions;
+    IdleCyclesElided += instructions;
+    return instructions;
+}
@@ -0,0 +1,21 @@
+#ifndef IDLE_H
+#define IDLE_H
+
+#include <stdint.h>
+#include "CHIP8.h"
+
+// Idle Loops: Jump-To-Self & Delay Timer Polls That Can't Change State Until The Timer Gets There
+enum
+{
+    IDLE_NONE,
+    IDLE_JUMP_SELF,  // 1NNN With NNN == Its Own Address
+    IDLE_TIMER_POLL  // FX07, 3XNN, 1NNN Back To The FX07
+};
+
+// Instructions Skipped Instead Of Executed
+extern uint64_t IdleCyclesElided;
+
+void FindIdleLoops(int address, int length);
+int SkipIdleLoop(DecodedInstruction *D, int instructions);
+
+#endif
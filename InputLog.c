@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <string.h>
+#include "CHIP8.h"
+#include "InputLog.h"
+
+bool InputLogRecording = false;
+bool InputLogReplaying = false;
+
+static FILE *LogFile = NULL;
+
+// Keys Last Written (Recording)
+static uint16_t LogKeys = 0;
+
+// Next Entry Not Yet Applied (Replaying)
+static bool LogPending = false;
+static bool LogEnd = false;
+static unsigned long long LogFrame;
+static unsigned int LogMask;
+
+static uint16_t KeyMask()
+{
+    uint16_t mask = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        if (Chip8.Key[i] != 0)
+        {
+            mask |= 1 << i;
+        }
+    }
+    return mask;
+}
+
+// Read The Next Entry, A Missing Or Unreadable One Ends The Replay Where It Is
+static void ReadEntry()
+{
+    char word[16];
+
+    LogPending = (fscanf(LogFile, "%llu %15s", &LogFrame, word) == 2);
+    LogEnd = !LogPending || strcmp(word, "end") == 0;
+    if (LogPending && !LogEnd && sscanf(word, "%x", &LogMask) != 1)
+    {
+        LogEnd = true;
+    }
+}
+
+// Recording Writes The Seed Given, Replaying Reads It Back Into seed
+bool InputLogOpen(const char *path, bool replay, uint64_t *seed)
+{
+    LogFile = fopen(path, replay ? "r" : "w");
+    if (LogFile == NULL)
+    {
+        printf("Input Log: Couldn't Open %s\n", path);
+        return false;
+    }
+
+    if (replay)
+    {
+        unsigned long long value;
+        if (fscanf(LogFile, " seed %llu", &value) != 1)
+        {
+            printf("Input Log: %s Has No Seed\n", path);
+            fclose(LogFile);
+            LogFile = NULL;
+            return false;
+        }
+        *seed = value;
+        ReadEntry();
+        InputLogReplaying = true;
+    }
+    else
+    {
+        fprintf(LogFile, "seed %llu\n", (unsigned long long)*seed);
+        LogKeys = 0;
+        InputLogRecording = true;
+    }
+    return true;
+}
+
+// Called Once Per Frame Before It Runs: Logs Key Changes, Or Replaces The Keys With The Logged Ones.
+// False Once A Replay Reaches The Frame Its Recording Stopped On
+bool InputLogFrame(uint64_t frame)
+{
+    if (InputLogRecording)
+    {
+        uint16_t keys = KeyMask();
+        if (keys != LogKeys)
+        {
+            fprintf(LogFile, "%llu %04x\n", (unsigned long long)frame, keys);
+            LogKeys = keys;
+        }
+    }
+    else if (InputLogReplaying)
+    {
+        while (LogPending && LogFrame <= frame)
+        {
+            if (LogEnd)
+            {
+                return false;
+            }
+            for (int i = 0; i < 16; i++)
+            {
+                Chip8.Key[i] = (LogMask >> i) & 1;
+            }
+            ReadEntry();
+        }
+    }
+    return true;
+}
+
+void InputLogClose(uint64_t frame)
+{
+    if (LogFile == NULL)
+    {
+        return;
+    }
+
+    if (InputLogRecording)
+    {
+        fprintf(LogFile, "%llu end\n", (unsigned long long)frame);
+    }
+    fclose(LogFile);
+    LogFile = NULL;
+    InputLogRecording = false;
+    InputLogReplaying = false;
+}
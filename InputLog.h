@@ -0,0 +1,22 @@
+#ifndef INPUT_LOG_H
+#define INPUT_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Input Log File Layout (Text, One Entry Per Line)
+//
+//   seed <Decimal Seed>        First Line, The Seed CXNN Was Started From
+//   <Frame> <Key Mask>         Keys Held From That Frame On (Hex, Bit N = Key N), Only When They Changed
+//   <Frame> end                The Frame The Recorded Run Stopped On
+//
+// Keys Are Only Sampled At Frame Boundaries, So Seed + Log Pin Down Every Instruction
+
+extern bool InputLogRecording;
+extern bool InputLogReplaying;
+
+bool InputLogOpen(const char *path, bool replay, uint64_t *seed);
+bool InputLogFrame(uint64_t frame);
+void InputLogClose(uint64_t frame);
+
+#endif
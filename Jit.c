@@ -0,0 +1,864 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "CHIP8.h"
+#include "Jit.h"
+
+bool JitActive = false;
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#include <sys/mman.h>
+
+// Tuning
+#define JIT_HOT_THRESHOLD 8
+#define JIT_MAX_BLOCK 64
+#define JIT_CODE_SIZE (4 * 1024 * 1024)
+#define JIT_MAX_BLOCK_BYTES (8 * 1024)
+
+// Host Registers (x86-64 Encoding Numbers)
+#define EAX 0
+#define ECX 1
+#define EDX 2
+#define EBX 3
+#define EBP 5
+#define ESI 6
+#define EDI 7
+
+// Virtual Register Index Of I (V0-VF Are 0-15)
+#define VREG_I 16
+
+// Condition Codes
+#define CC_B 0x2
+#define CC_AE 0x3
+#define CC_E 0x4
+#define CC_NE 0x5
+
+// Host Registers Available To Hold V & I (EAX, ECX Are Scratch, RDI Points At The CPU)
+const int HostPool[] = {EDX, ESI, 8, 9, 10, 11, EBX, EBP, 12, 13, 14, 15};
+#define HOST_POOL_SIZE (int)(sizeof(HostPool) / sizeof(HostPool[0]))
+
+// Compiled Block Returns The Number Of Instructions It Executed
+typedef int (*JitCode)(CHIP8_CPU *cpu);
+
+typedef struct
+{
+    JitCode Code;
+    uint16_t End;
+    uint8_t Length;
+    uint8_t Heat;
+    bool Failed;
+
+} JitBlock;
+
+static JitBlock Blocks[MEMORY_SIZE];
+
+// Number Of Compiled Blocks Covering Each Byte Of Memory
+static uint16_t Covered[MEMORY_SIZE];
+
+static uint8_t *CodeBuffer = NULL;
+static size_t CodeUsed = 0;
+static uint8_t *Emit;
+static bool Verify = false;
+
+// Per-Block Register Assignment
+static int Host[17];
+static uint32_t DirtyMask;
+static uint32_t SavedMask;
+
+// Emitters
+
+static void Byte(uint8_t value)
+{
+    *Emit++ = value;
+}
+
+static void Dword(uint32_t value)
+{
+    memcpy(Emit, &value, 4);
+    Emit += 4;
+}
+
+// op r/m32, r32 (Register Form)
+static void AluRR(uint8_t op, int dst, int src)
+{
+    if (dst >= 8 || src >= 8)
+    {
+        Byte(0x40 | ((src >= 8) << 2) | (dst >= 8));
+    }
+    Byte(op);
+    Byte(0xC0 | ((src & 7) << 3) | (dst & 7));
+}
+
+#define MovRR(dst, src) AluRR(0x89, dst, src)
+#define AddRR(dst, src) AluRR(0x01, dst, src)
+#define OrRR(dst, src) AluRR(0x09, dst, src)
+#define AndRR(dst, src) AluRR(0x21, dst, src)
+#define SubRR(dst, src) AluRR(0x29, dst, src)
+#define XorRR(dst, src) AluRR(0x31, dst, src)
+#define CmpRR(dst, src) AluRR(0x39, dst, src)
+
+// op r/m32, imm32 (Group 1, ext Selects The Operation)
+static void AluRI(int ext, int dst, uint32_t imm)
+{
+    if (dst >= 8)
+    {
+        Byte(0x41);
+    }
+    Byte(0x81);
+    Byte(0xC0 | (ext << 3) | (dst & 7));
+    Dword(imm);
+}
+
+#define AddRI(dst, imm) AluRI(0, dst, imm)
+#define AndRI(dst, imm) AluRI(4, dst, imm)
+#define SubRI(dst, imm) AluRI(5, dst, imm)
+#define XorRI(dst, imm) AluRI(6, dst, imm)
+#define CmpRI(dst, imm) AluRI(7, dst, imm)
+
+static void MovRI(int dst, uint32_t imm)
+{
+    if (dst >= 8)
+    {
+        Byte(0x41);
+    }
+    Byte(0xB8 + (dst & 7));
+    Dword(imm);
+}
+
+// Shift r32 By imm8 (Group 2, 4 = SHL, 5 = SHR)
+static void ShiftRI(int ext, int dst, uint8_t count)
+{
+    if (dst >= 8)
+    {
+        Byte(0x41);
+    }
+    Byte(0xC1);
+    Byte(0xC0 | (ext << 3) | (dst & 7));
+    Byte(count);
+}
+
+#define ShlRI(dst, count) ShiftRI(4, dst, count)
+#define ShrRI(dst, count) ShiftRI(5, dst, count)
+
+// imul r32, r/m32, imm8
+static void ImulRRI(int dst, int src, int8_t imm)
+{
+    if (dst >= 8 || src >= 8)
+    {
+        Byte(0x40 | ((dst >= 8) << 2) | (src >= 8));
+    }
+    Byte(0x6B);
+    Byte(0xC0 | ((dst & 7) << 3) | (src & 7));
+    Byte(imm);
+}
+
+// ModRM For [rdi + disp32]
+static void MemCPU(int reg, int32_t disp)
+{
+    Byte(0x80 | ((reg & 7) << 3) | EDI);
+    Dword(disp);
+}
+
+// ModRM + SIB For [rdi + rax * 2 + disp32] (Stack Slot Indexed By SP In EAX)
+static void MemStack(int reg)
+{
+    Byte(0x84 | ((reg & 7) << 3));
+    Byte(0x40 | (EAX << 3) | EDI);
+    Dword(offsetof(CHIP8_CPU, Stack));
+}
+
+static void LoadByte(int dst, int32_t disp)
+{
+    if (dst >= 8)
+    {
+        Byte(0x44);
+    }
+    Byte(0x0F);
+    Byte(0xB6);
+    MemCPU(dst, disp);
+}
+
+static void LoadWord(int dst, int32_t disp)
+{
+    if (dst >= 8)
+    {
+        Byte(0x44);
+    }
+    Byte(0x0F);
+    Byte(0xB7);
+    MemCPU(dst, disp);
+}
+
+// REX Is Always Emitted So SIL/BPL Are Addressable Instead Of DH/CH
+static void StoreByte(int32_t disp, int src)
+{
+    Byte(0x40 | ((src >= 8) << 2));
+    Byte(0x88);
+    MemCPU(src, disp);
+}
+
+static void StoreWord(int32_t disp, int src)
+{
+    Byte(0x66);
+    if (src >= 8)
+    {
+        Byte(0x44);
+    }
+    Byte(0x89);
+    MemCPU(src, disp);
+}
+
+static void StoreWordImm(int32_t disp, uint16_t imm)
+{
+    Byte(0x66);
+    Byte(0xC7);
+    MemCPU(0, disp);
+    Byte(imm & 0xFF);
+    Byte(imm >> 8);
+}
+
+static void LoadStack(int dst)
+{
+    if (dst >= 8)
+    {
+        Byte(0x44);
+    }
+    Byte(0x0F);
+    Byte(0xB7);
+    MemStack(dst);
+}
+
+static void StoreStack(int src)
+{
+    Byte(0x66);
+    if (src >= 8)
+    {
+        Byte(0x44);
+    }
+    Byte(0x89);
+    MemStack(src);
+}
+
+// Jump With rel32 To Be Patched, Returns Patch Location
+static uint8_t *Jcc(int cc)
+{
+    Byte(0x0F);
+    Byte(0x80 | cc);
+    uint8_t *patch = Emit;
+    Dword(0);
+    return patch;
+}
+
+static void PatchHere(uint8_t *patch)
+{
+    int32_t rel = (int32_t)(Emit - (patch + 4));
+    memcpy(patch, &rel, 4);
+}
+
+static void Push(int reg)
+{
+    if (reg >= 8)
+    {
+        Byte(0x41);
+    }
+    Byte(0x50 + (reg & 7));
+}
+
+static void Pop(int reg)
+{
+    if (reg >= 8)
+    {
+        Byte(0x41);
+    }
+    Byte(0x58 + (reg & 7));
+}
+
+static bool IsCalleeSaved(int reg)
+{
+    return reg == EBX || reg == EBP || reg >= 12;
+}
+
+// Block Exit: Write Back Registers, Set PC (Immediate, Or From EAX When dynamic), Return Executed Count
+static void EmitExit(bool dynamic, uint16_t PC, int executed)
+{
+    for (int v = 0; v <= VREG_I; v++)
+    {
+        if (DirtyMask & (1u << v))
+        {
+            if (v == VREG_I)
+            {
+                StoreWord(offsetof(CHIP8_CPU, I), Host[v]);
+            }
+            else
+            {
+                StoreByte(offsetof(CHIP8_CPU, V) + v, Host[v]);
+            }
+        }
+    }
+
+    if (dynamic)
+    {
+        StoreWord(offsetof(CHIP8_CPU, PC), EAX);
+    }
+    else
+    {
+        StoreWordImm(offsetof(CHIP8_CPU, PC), PC);
+    }
+    MovRI(EAX, executed);
+
+    for (int i = HOST_POOL_SIZE - 1; i >= 0; i--)
+    {
+        if (SavedMask & (1u << HostPool[i]))
+        {
+            Pop(HostPool[i]);
+        }
+    }
+    Byte(0xC3);
+}
+
+// Virtual Registers An Instruction Reads Or Writes, False If The JIT Can't Compile It
+static bool Operands(const DecodedInstruction *D, uint32_t *used, uint32_t *written, bool *terminator)
+{
+    OpcodeHandler H = D->Handler;
+    uint32_t X = 1u << D->X;
+    uint32_t Y = 1u << D->Y;
+    uint32_t F = 1u << 0xF;
+    uint32_t I = 1u << VREG_I;
+
+    *used = 0;
+    *written = 0;
+    *terminator = false;
+
+    if (H == Op_Unknown)
+    {
+    }
+    else if (H == Op_1NNN || H == Op_2NNN || H == Op_00EE)
+    {
+        *terminator = true;
+    }
+    else if (H == Op_3XNN || H == Op_4XNN)
+    {
+        *used = X;
+        *terminator = true;
+    }
+    else if (H == Op_5XY0 || H == Op_9XY0)
+    {
+        *used = X | Y;
+        *terminator = true;
+    }
+    else if (H == Op_BNNN)
+    {
+        *used = 1u << 0;
+        *terminator = true;
+    }
+    else if (H == Op_6XNN || H == Op_7XNN)
+    {
+        *used = *written = X;
+    }
+    else if (H == Op_8XY0 || H == Op_8XY1 || H == Op_8XY2 || H == Op_8XY3)
+    {
+        *used = X | Y;
+        *written = X;
+    }
+    else if (H == Op_8XY4 || H == Op_8XY5 || H == Op_8XY7)
+    {
+        *used = X | Y | F;
+        *written = X | F;
+    }
+    else if (H == Op_8XY6 || H == Op_8XYE)
+    {
+        *used = *written = X | F;
+    }
+    else if (H == Op_ANNN)
+    {
+        *used = *written = I;
+    }
+    else if (H == Op_FX1E || H == Op_FX29)
+    {
+        *used = X | I;
+        *written = I;
+    }
+    else
+    {
+        // DXYN, FX0A, CXNN, Timer, Key & Memory Ops Stay In The Interpreter (Timers Need The Exact Cycle)
+        return false;
+    }
+    return true;
+}
+
+static int CountBits(uint32_t mask)
+{
+    int count = 0;
+    for (; mask != 0; mask &= mask - 1)
+    {
+        count++;
+    }
+    return count;
+}
+
+static void FlushBlocks()
+{
+    memset(Blocks, 0, sizeof(Blocks));
+    memset(Covered, 0, sizeof(Covered));
+    CodeUsed = 0;
+}
+
+static void CompileBlock(uint16_t start)
+{
+    DecodedInstruction Instructions[JIT_MAX_BLOCK];
+    uint32_t usedMask = 0;
+    uint32_t dirtyMask = 0;
+    int length = 0;
+    uint16_t address = start;
+    bool terminated = false;
+
+    // Scan: Extend The Block Until A Terminator, An Unsupported Opcode, Or Host Registers Run Out
+    while (length < JIT_MAX_BLOCK && address < MEMORY_SIZE - 1 && !terminated)
+    {
+        DecodedInstruction D;
+        uint32_t used, written;
+
+        DecodeInstruction(address, &D);
+        if (!Operands(&D, &used, &written, &terminated) || CountBits(usedMask | used) > HOST_POOL_SIZE)
+        {
+            terminated = false;
+            break;
+        }
+
+        usedMask |= used;
+        dirtyMask |= written;
+        Instructions[length++] = D;
+        address += 2;
+    }
+
+    JitBlock *B = &Blocks[start];
+    if (length == 0)
+    {
+        B->Failed = true;
+        return;
+    }
+
+    if (CodeUsed + JIT_MAX_BLOCK_BYTES > JIT_CODE_SIZE)
+    {
+        FlushBlocks();
+    }
+
+    // Assign Host Registers
+    SavedMask = 0;
+    DirtyMask = dirtyMask;
+    int next = 0;
+    for (int v = 0; v <= VREG_I; v++)
+    {
+        Host[v] = -1;
+        if (usedMask & (1u << v))
+        {
+            Host[v] = HostPool[next++];
+            if (IsCalleeSaved(Host[v]))
+            {
+                SavedMask |= 1u << Host[v];
+            }
+        }
+    }
+
+    mprotect(CodeBuffer, JIT_CODE_SIZE, PROT_READ | PROT_WRITE);
+    uint8_t *entry = CodeBuffer + CodeUsed;
+    Emit = entry;
+
+    // Prologue: Save Callee-Saved Registers, Load Guest Registers
+    for (int i = 0; i < HOST_POOL_SIZE; i++)
+    {
+        if (SavedMask & (1u << HostPool[i]))
+        {
+            Push(HostPool[i]);
+        }
+    }
+    for (int v = 0; v <= VREG_I; v++)
+    {
+        if (Host[v] >= 0)
+        {
+            if (v == VREG_I)
+            {
+                LoadWord(Host[v], offsetof(CHIP8_CPU, I));
+            }
+            else
+            {
+                LoadByte(Host[v], offsetof(CHIP8_CPU, V) + v);
+            }
+        }
+    }
+
+    // Body
+    for (int n = 0; n < length; n++)
+    {
+        DecodedInstruction *D = &Instructions[n];
+        OpcodeHandler H = D->Handler;
+        uint16_t at = start + 2 * n;
+        int X = Host[D->X];
+        int Y = Host[D->Y];
+        int F = Host[0xF];
+        int I = Host[VREG_I];
+        int executed = n + 1;
+        uint8_t *skip;
+
+        if (H == Op_6XNN)
+        {
+            MovRI(X, D->NN);
+        }
+        else if (H == Op_7XNN)
+        {
+            AddRI(X, D->NN);
+            AndRI(X, 0xFF);
+        }
+        else if (H == Op_8XY0)
+        {
+            MovRR(X, Y);
+        }
+        else if (H == Op_8XY1)
+        {
+            OrRR(X, Y);
+        }
+        else if (H == Op_8XY2)
+        {
+            AndRR(X, Y);
+        }
+        else if (H == Op_8XY3)
+        {
+            XorRR(X, Y);
+        }
+        else if (H == Op_8XY4)
+        {
+            // Sum In EAX, Vx = Low Byte, VF = Carry
+            MovRR(EAX, X);
+            AddRR(EAX, Y);
+            MovRR(X, EAX);
+            AndRI(X, 0xFF);
+            ShrRI(EAX, 8);
+            MovRR(F, EAX);
+        }
+        else if (H == Op_8XY5)
+        {
+            // Sign Of The 32-Bit Difference Gives The Borrow, VF = !Borrow
+            MovRR(EAX, X);
+            SubRR(EAX, Y);
+            MovRR(X, EAX);
+            AndRI(X, 0xFF);
+            ShrRI(EAX, 31);
+            XorRI(EAX, 1);
+            MovRR(F, EAX);
+        }
+        else if (H == Op_8XY6)
+        {
+            MovRR(EAX, X);
+            AndRI(EAX, 1);
+            MovRR(F, EAX);
+            ShrRI(X, 1);
+        }
+        else if (H == Op_8XY7)
+        {
+            // Vx = Vy - Vx, Then VF = (Vy >= New Vx)
+            MovRR(EAX, Y);
+            SubRR(EAX, X);
+            AndRI(EAX, 0xFF);
+            MovRR(X, EAX);
+            MovRR(EAX, Y);
+            SubRR(EAX, X);
+            ShrRI(EAX, 31);
+            XorRI(EAX, 1);
+            MovRR(F, EAX);
+        }
+        else if (H == Op_8XYE)
+        {
+            MovRR(EAX, X);
+            ShrRI(EAX, 7);
+            MovRR(F, EAX);
+            ShlRI(X, 1);
+            AndRI(X, 0xFF);
+        }
+        else if (H == Op_ANNN)
+        {
+            MovRI(I, D->NNN);
+        }
+        else if (H == Op_FX1E)
+        {
+            AddRR(I, X);
+            AndRI(I, 0xFFFF);
+        }
+        else if (H == Op_FX29)
+        {
+            ImulRRI(I, X, 5);
+        }
+        else if (H == Op_1NNN)
+        {
+            EmitExit(false, D->NNN, executed);
+        }
+        else if (H == Op_2NNN)
+        {
+            // Stack Full, Leave The Call To The Interpreter
+            LoadByte(EAX, offsetof(CHIP8_CPU, SP));
+            CmpRI(EAX, 16);
+            uint8_t *full = Jcc(CC_AE);
+            MovRI(ECX, (uint16_t)(at + 2));
+            StoreStack(ECX);
+            AddRI(EAX, 1);
+            StoreByte(offsetof(CHIP8_CPU, SP), EAX);
+            EmitExit(false, D->NNN, executed);
+            PatchHere(full);
+            EmitExit(false, at, executed - 1);
+        }
+        else if (H == Op_00EE)
+        {
+            // Stack Empty (Or Deeper Than The 16 Entries), Leave The Underflow Report & Wrap To The Interpreter
+            LoadByte(EAX, offsetof(CHIP8_CPU, SP));
+            SubRI(EAX, 1);
+            CmpRI(EAX, 16);
+            uint8_t *empty = Jcc(CC_AE);
+            StoreByte(offsetof(CHIP8_CPU, SP), EAX);
+            LoadStack(EAX);
+            EmitExit(true, 0, executed);
+            PatchHere(empty);
+            EmitExit(false, at, executed - 1);
+        }
+        else if (H == Op_BNNN)
+        {
+            MovRR(EAX, Host[0x0]);
+            AddRI(EAX, D->NNN);
+            EmitExit(true, 0, executed);
+        }
+        else if (H == Op_3XNN || H == Op_4XNN || H == Op_5XY0 || H == Op_9XY0)
+        {
+            if (H == Op_3XNN || H == Op_4XNN)
+            {
+                CmpRI(X, D->NN);
+            }
+            else
+            {
+                CmpRR(X, Y);
+            }
+
+            // Branch To The Fall-Through Exit When The Skip Condition Fails
+            skip = Jcc((H == Op_3XNN || H == Op_5XY0) ? CC_NE : CC_E);
+            EmitExit(false, at + 4, executed);
+            PatchHere(skip);
+            EmitExit(false, at + 2, executed);
+        }
+    }
+
+    // Block Ended Without A Terminator, Continue At The Next Instruction
+    if (!terminated)
+    {
+        EmitExit(false, address, length);
+    }
+
+    CodeUsed += Emit - entry;
+    mprotect(CodeBuffer, JIT_CODE_SIZE, PROT_READ | PROT_EXEC);
+
+    B->Code = (JitCode)entry;
+    B->Length = length;
+    B->End = address;
+    for (int i = start; i < address && i < MEMORY_SIZE; i++)
+    {
+        Covered[i]++;
+    }
+}
+
+// Runs A Block Then Replays It Through The Interpreter, Stopping On Any Difference
+static int VerifyBlock(uint16_t start, JitBlock *B)
+{
+    static CHIP8_CPU Before;
+    static CHIP8_CPU Compiled;
+
+    Before = Chip8;
+    int executed = B->Code(&Chip8);
+    Compiled = Chip8;
+    Compiled.Cycles += executed;
+
+    Chip8 = Before;
+    for (int i = 0; i < executed; i++)
+    {
+        ExecuteInstructions();
+    }
+
+    if (Compiled.PC != Chip8.PC || Compiled.I != Chip8.I || Compiled.SP != Chip8.SP ||
+        Compiled.Delay_Timer.Value != Chip8.Delay_Timer.Value || Compiled.Delay_Timer.Cycle != Chip8.Delay_Timer.Cycle ||
+        Compiled.Sound_Timer.Value != Chip8.Sound_Timer.Value || Compiled.Sound_Timer.Cycle != Chip8.Sound_Timer.Cycle ||
+        Compiled.Cycles != Chip8.Cycles ||
+        memcmp(Compiled.V, Chip8.V, sizeof(Chip8.V)) != 0 ||
+        memcmp(Compiled.Stack, Chip8.Stack, sizeof(Chip8.Stack)) != 0 ||
+        memcmp(Compiled.Memory, Chip8.Memory, sizeof(Chip8.Memory)) != 0)
+    {
+        printf("JIT Mismatch In Block %04x (%d Instructions, %d Executed)\n", start, B->Length, executed);
+        printf("  JIT:         PC=%04x I=%04x SP=%x", Compiled.PC, Compiled.I, Compiled.SP);
+        for (int i = 0; i < 16; i++)
+        {
+            printf(" %02x", Compiled.V[i]);
+        }
+        printf("\n  Interpreter: PC=%04x I=%04x SP=%x", Chip8.PC, Chip8.I, Chip8.SP);
+        for (int i = 0; i < 16; i++)
+        {
+            printf(" %02x", Chip8.V[i]);
+        }
+        printf("\n");
+        exit(1);
+    }
+    return executed;
+}
+
+bool JitInitialize(bool verify)
+{
+    CodeBuffer = mmap(NULL, JIT_CODE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (CodeBuffer == MAP_FAILED)
+    {
+        CodeBuffer = NULL;
+        printf("JIT: Couldn't Allocate Code Buffer, Using Interpreter\n");
+        return false;
+    }
+
+    FlushBlocks();
+    Verify = verify;
+    JitActive = true;
+    return true;
+}
+
+void JitExecute(int instructions)
+{
+    while (instructions > 0 && !WaitingForKey())
+    {
+        uint16_t PC = Chip8.PC;
+
+        if (PC < MEMORY_SIZE - 1)
+        {
+            JitBlock *B = &Blocks[PC];
+
+            if (B->Code == NULL && !B->Failed && ++B->Heat >= JIT_HOT_THRESHOLD)
+            {
+                CompileBlock(PC);
+            }
+
+            // Only Enter Blocks That Fit In The Remaining Budget
+            if (B->Code != NULL && B->Length <= instructions)
+            {
+                int executed;
+                if (Verify)
+                {
+                    executed = VerifyBlock(PC, B);
+                }
+                else
+                {
+                    executed = B->Code(&Chip8);
+                    Chip8.Cycles += executed;
+                }
+
+                // A Block Bailing Out On Its First Instruction Leaves It To The Interpreter
+                if (executed > 0)
+                {
+                    instructions -= executed;
+                    continue;
+                }
+            }
+        }
+
+        ExecuteInstructions();
+        instructions--;
+    }
+
+    // Halted Time Still Counts Towards The Timers
+    if (instructions > 0)
+    {
+        Chip8.Cycles += instructions;
+    }
+}
+
+void JitInvalidate(int address, int length)
+{
+    if (!JitActive)
+    {
+        return;
+    }
+
+    int end = address + length;
+    if (address < 0)
+    {
+        address = 0;
+    }
+    if (end > MEMORY_SIZE)
+    {
+        end = MEMORY_SIZE;
+    }
+
+    // Let Failed Starts Whose Opcode Changed Try Again
+    for (int i = (address > 0) ? address - 1 : 0; i < end; i++)
+    {
+        Blocks[i].Failed = false;
+        Blocks[i].Heat = 0;
+    }
+
+    // Cheap Exit For Writes Outside Any Compiled Code
+    bool hit = false;
+    for (int i = address; i < end; i++)
+    {
+        if (Covered[i] != 0)
+        {
+            hit = true;
+            break;
+        }
+    }
+    if (!hit)
+    {
+        return;
+    }
+
+    // Drop Every Block Overlapping The Written Bytes (Code Space Is Reclaimed On The Next Flush)
+    int first = address - 2 * JIT_MAX_BLOCK;
+    for (int start = (first > 0) ? first : 0; start < end; start++)
+    {
+        JitBlock *B = &Blocks[start];
+        if (B->Code != NULL && start < end && B->End > address)
+        {
+            for (int i = start; i < B->End; i++)
+            {
+                Covered[i]--;
+            }
+            B->Code = NULL;
+            B->Heat = 0;
+        }
+    }
+}
+
+void JitShutdown()
+{
+    if (CodeBuffer != NULL)
+    {
+        munmap(CodeBuffer, JIT_CODE_SIZE);
+        CodeBuffer = NULL;
+    }
+    JitActive = false;
+}
+
+#else
+
+// Other Hosts Run Everything Through The Interpreter
+
+bool JitInitialize(bool verify)
+{
+    printf("JIT: Only Supported On x86-64 Hosts, Using Interpreter\n");
+    return false;
+}
+
+void JitExecute(int instructions)
+{
+    for (int i = 0; i < instructions; i++)
+    {
+        ExecuteInstructions();
+    }
+}
+
+void JitInvalidate(int address, int length)
+{
+}
+
+void JitShutdown()
+{
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include <stdbool.h>
+
+// x86-64 Dynamic Recompiler For Hot CHIP-8 Basic Blocks
+extern bool JitActive;
+
+bool JitInitialize(bool verify);
+void JitExecute(int instructions);
+void JitInvalidate(int address, int length);
+void JitShutdown();
+
+#endif
@@ -0,0 +1,794 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <SDL2/SDL.h>
+#include "CHIP8.h"
+#include "Trace.h"
+#include "ExecTrace.h"
+#include "Fusion.h"
+#include "Idle.h"
+#include "Vip.h"
+#include "Quirks.h"
+#include "InputLog.h"
+#include "Pacing.h"
+#include "Tuning.h"
+#include "Runner.h"
+#include "Expand.h"
+#include "Upscale.h"
+#ifdef AOT
+#include "Aot.h"
+#endif
+
+#define EMULATION_SPEED 60
+
+// Display Texture Colours (ARGB8888)
+#define PIXEL_ON 0xFFFFFFFF
+#define PIXEL_OFF 0xFF000000
+
+// Command Line Options
+typedef struct
+{
+    const char *ROM;
+    const char *ExecTraceFile;
+    const char *Profile;
+    const char *RecordFile;
+    const char *ReplayFile;
+    const char *Upscaler;
+    uint64_t Seed;
+    bool Deterministic;
+    bool DisplaySync;
+    bool FastForward;
+    int Speed;
+    bool AutoIpf;
+    bool Jit;
+    bool JitVerify;
+    bool Closure;
+    bool Vip;
+    bool Stats;
+
+} CHIP8_OPTIONS;
+
+CHIP8_OPTIONS Options;
+
+// Frames Run So Far (Input Logs Are Keyed On It)
+uint64_t Frames = 0;
+
+// Uncapped Speed (Tab Or -f), Audio Is Muted While On
+bool FastForward = false;
+
+// Host Frames That Presented, & Those That Skipped It (Nothing Changed, Or Between Fast Forward Presents)
+uint64_t Presents = 0;
+uint64_t PresentsSkipped = 0;
+
+// Frame Budget, Picked Per ROM With -a
+int InstructionsPerFrame = INSTRUCTIONS_PER_FRAME;
+
+// The Display Through The -u Filter
+UPSCALE_IMAGE Upscaled;
+
+void AudioCallback(void *userdata, Uint8 *stream, int len)
+{
+    float *buffer = (float *)stream;
+    int samples = len / sizeof(float);
+    static float phase = 0.0f;
+
+    for (int i = 0; i < samples; i++)
+    {
+        if (!FastForward && ReadTimer(&Chip8.Sound_Timer, Chip8.Cycles + 1) > 0) // Generate sound only when the timer is active
+        {
+            buffer[i] = sinf(phase * 2.0f * M_PI) * 0.5f; // Sine wave for the beep
+            phase += 440.0f / 44100.0f;                   // 440 Hz tone
+            if (phase >= 1.0f)
+                phase -= 1.0f;
+        }
+        else
+        {
+            buffer[i] = 0.0f; // Silence
+        }
+    }
+}
+
+// Block Until An Event Arrives, Or Only Until The Next Timer Tick While The Delay Timer Is Running
+int WaitForEvent(SDL_Event *event)
+{
+    if (ReadTimer(&Chip8.Delay_Timer, Chip8.Cycles + 1) > 0)
+    {
+        return SDL_WaitEventTimeout(event, 1000 / EMULATION_SPEED);
+    }
+
+    // No Timer Runs While Blocked Here, So No Emulated Time Is Owed For It
+    int pending = SDL_WaitEvent(event);
+    PacingResync();
+    return pending;
+}
+
+// Expand The Rows Changed Since The Last Upload Into The Streaming Texture, Locking Only The Span They Cover
+// (Locked Pixels Are Write-Only, So Every Row In The Span Is Rewritten)
+void UpdateDisplayTexture(SDL_Texture *texture, uint32_t rows)
+{
+    int first = 0;
+    int last = GRID_HEIGHT - 1;
+    while ((rows & (1u << first)) == 0)
+    {
+        first++;
+    }
+    while ((rows & (1u << last)) == 0)
+    {
+        last--;
+    }
+
+    void *pixels;
+    int pitch;
+    SDL_Rect span = {0, first, GRID_WIDTH, last - first + 1};
+    if (SDL_LockTexture(texture, &span, &pixels, &pitch) != 0)
+    {
+        return;
+    }
+
+    ExpandRows32(Chip8.Display, 1, first, last, 1, PIXEL_ON, PIXEL_OFF, pixels, pitch);
+    SDL_UnlockTexture(texture);
+}
+
+// With An Upscaler Every Row Depends On Its Neighbours, So The Whole Texture Is Filtered & Uploaded Again
+void UpdateUpscaledTexture(SDL_Texture *texture, int scale)
+{
+    void *pixels;
+    int pitch;
+    if (SDL_LockTexture(texture, NULL, &pixels, &pitch) != 0)
+    {
+        return;
+    }
+
+    UpscaleDisplay(Chip8.Display, &Upscaled);
+    UpscaleExpand32(&Upscaled, scale, PIXEL_ON, PIXEL_OFF, pixels, pitch);
+    SDL_UnlockTexture(texture);
+}
+
+void SetFastForward(bool on)
+{
+    FastForward = on;
+    PacingSetSpeed(on ? Options.Speed : 1);
+}
+
+// Frame Budget & Timer Tick Change Together, On A Frame Boundary
+void SetInstructionsPerFrame(int instructionsPerFrame)
+{
+    InstructionsPerFrame = instructionsPerFrame;
+    SetTickCycles(instructionsPerFrame);
+    PacingSetInstructionsPerFrame(instructionsPerFrame);
+}
+
+void Run()
+{
+    // Setting RunTime Variables
+    SDL_Window *window;
+    SDL_Renderer *renderer;
+    SDL_Event event;
+    bool run = true;
+    bool redraw = true;
+    int framePosition = 0;
+
+    SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+    TRACE_START();
+
+    // Getting Screen Resolution
+    SDL_DisplayMode dm;
+    SDL_GetCurrentDisplayMode(0, &dm);
+    int SCREEN_WIDTH = 640;
+    int SCREEN_HEIGHT = 320;
+
+    // Uniform Scaling Cell According to Resolution
+    int CELL_WIDTH = SCREEN_WIDTH / GRID_WIDTH;
+    int CELL_HEIGHT = SCREEN_HEIGHT / GRID_HEIGHT;
+    int CELL_SIZE = (CELL_WIDTH > CELL_HEIGHT) ? CELL_HEIGHT : CELL_WIDTH;
+
+    // Setting Window, Renderer & Audio (Presenting Waits For The Display When Synced To It)
+    if (Options.DisplaySync)
+    {
+        SDL_SetHint(SDL_HINT_RENDER_VSYNC, "1");
+    }
+    SDL_CreateWindowAndRenderer(SCREEN_WIDTH, SCREEN_HEIGHT, 0, &window, &renderer);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+
+    // The Display Is One Streaming Texture, Stretched Over The Cells With Nearest Neighbour Scaling. Filtered By
+    // -u, It's Built At The Largest Whole Multiple Of The Filter's Output Within A Cell, So That When The Cell Size
+    // Divides Evenly A Software Renderer Copies It Without Stretching
+    int textureScale = 1;
+    if (Upscaler != NULL && CELL_SIZE / Upscaler->Factor > 1)
+    {
+        textureScale = CELL_SIZE / Upscaler->Factor;
+    }
+    int textureFactor = (Upscaler != NULL) ? Upscaler->Factor * textureScale : 1;
+    SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                             GRID_WIDTH * textureFactor, GRID_HEIGHT * textureFactor);
+    SDL_SetTextureScaleMode(texture, SDL_ScaleModeNearest);
+    SDL_Rect screen = {0, 0, GRID_WIDTH * CELL_SIZE, GRID_HEIGHT * CELL_SIZE};
+
+    // Audio Setup
+    SDL_AudioSpec want, have;
+    SDL_zero(want);
+    want.freq = 44100;          // 44.1 kHz
+    want.format = AUDIO_F32SYS; // Float 32-bit audio
+    want.channels = 1;          // Mono
+    want.samples = 2048;
+    want.callback = AudioCallback;
+    SDL_PauseAudio(0);
+
+    PacingStart(EMULATION_SPEED, InstructionsPerFrame, Options.DisplaySync, dm.refresh_rate);
+    SetFastForward(Options.FastForward);
+
+    // Fast Forward Shows Its Speed In The Title, Measured Over Each Second
+    Uint32 speedTicks = SDL_GetTicks();
+    uint64_t speedFrames = 0;
+
+    // Main Loop
+    while (run)
+    {
+        // Waiting On FX0A With No Sound Playing: Sleep In The Event Queue Instead Of Polling
+        int pending;
+        if (Chip8.Halted && !InputLogReplaying && ReadTimer(&Chip8.Sound_Timer, Chip8.Cycles + 1) == 0)
+        {
+            pending = WaitForEvent(&event);
+        }
+        else
+        {
+            pending = SDL_PollEvent(&event);
+        }
+
+        // Event Handling
+        for (; pending; pending = SDL_PollEvent(&event))
+        {
+            if (event.type == SDL_QUIT)
+            {
+                run = false;
+            }
+
+            // The Window Lost What Was Drawn In It, Draw It All Again
+            if (event.type == SDL_WINDOWEVENT &&
+                (event.window.event == SDL_WINDOWEVENT_EXPOSED || event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
+            {
+                redraw = true;
+            }
+
+            // Tab Toggles Fast Forward (Replays Included)
+            if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_TAB && event.key.repeat == 0)
+            {
+                SetFastForward(!FastForward);
+                SDL_SetWindowTitle(window, "");
+                speedTicks = SDL_GetTicks();
+                speedFrames = Frames;
+                continue;
+            }
+
+            // A Replay Takes Its Keys From The Log Only
+            if (InputLogReplaying)
+            {
+                continue;
+            }
+
+            if (event.type == SDL_KEYDOWN)
+            {
+                switch (event.key.keysym.sym)
+                {
+                case SDLK_1:
+                    Chip8.Key[0x1] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x1);
+                    break;
+
+                case SDLK_2:
+                    Chip8.Key[0x2] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x2);
+                    break;
+
+                case SDLK_3:
+                    Chip8.Key[0x3] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x3);
+                    break;
+
+                case SDLK_4:
+                    Chip8.Key[0xC] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0xC);
+                    break;
+
+                case SDLK_q:
+                    Chip8.Key[0x4] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x4);
+                    break;
+
+                case SDLK_w:
+                    Chip8.Key[0x5] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x5);
+                    break;
+
+                case SDLK_e:
+                    Chip8.Key[0x6] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x6);
+                    break;
+
+                case SDLK_r:
+                    Chip8.Key[0xD] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0xD);
+                    break;
+
+                case SDLK_a:
+                    Chip8.Key[0x7] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x7);
+                    break;
+
+                case SDLK_s:
+                    Chip8.Key[0x8] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x8);
+                    break;
+
+                case SDLK_d:
+                    Chip8.Key[0x9] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x9);
+                    break;
+
+                case SDLK_f:
+                    Chip8.Key[0xE] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0xE);
+                    break;
+
+                case SDLK_z:
+                    Chip8.Key[0xA] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0xA);
+                    break;
+
+                case SDLK_x:
+                    Chip8.Key[0x0] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0x0);
+                    break;
+
+                case SDLK_c:
+                    Chip8.Key[0xB] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0xB);
+                    break;
+
+                case SDLK_v:
+                    Chip8.Key[0xF] = 1;
+                    TRACE_INPUT("Key %X pressed\n", 0xF);
+                    break;
+
+                default:
+                    TRACE_INPUT("Key Not For Emulator\n", 0);
+                    break;
+                }
+            }
+
+            if (event.type == SDL_KEYUP)
+            {
+                switch (event.key.keysym.sym)
+                {
+                case SDLK_1:
+                    Chip8.Key[0x1] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x1);
+                    break;
+
+                case SDLK_2:
+                    Chip8.Key[0x2] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x2);
+                    break;
+
+                case SDLK_3:
+                    Chip8.Key[0x3] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x3);
+                    break;
+
+                case SDLK_4:
+                    Chip8.Key[0xC] = 0;
+                    TRACE_INPUT("Key %X released\n", 0xC);
+                    break;
+
+                case SDLK_q:
+                    Chip8.Key[0x4] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x4);
+                    break;
+
+                case SDLK_w:
+                    Chip8.Key[0x5] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x5);
+                    break;
+
+                case SDLK_e:
+                    Chip8.Key[0x6] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x6);
+                    break;
+
+                case SDLK_r:
+                    Chip8.Key[0xD] = 0;
+                    TRACE_INPUT("Key %X released\n", 0xD);
+                    break;
+
+                case SDLK_a:
+                    Chip8.Key[0x7] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x7);
+                    break;
+
+                case SDLK_s:
+                    Chip8.Key[0x8] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x8);
+                    break;
+
+                case SDLK_d:
+                    Chip8.Key[0x9] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x9);
+                    break;
+
+                case SDLK_f:
+                    Chip8.Key[0xE] = 0;
+                    TRACE_INPUT("Key %X released\n", 0xE);
+                    break;
+
+                case SDLK_z:
+                    Chip8.Key[0xA] = 0;
+                    TRACE_INPUT("Key %X released\n", 0xA);
+                    break;
+
+                case SDLK_x:
+                    Chip8.Key[0x0] = 0;
+                    TRACE_INPUT("Key %X released\n", 0x0);
+                    break;
+
+                case SDLK_c:
+                    Chip8.Key[0xB] = 0;
+                    TRACE_INPUT("Key %X released\n", 0xB);
+                    break;
+
+                case SDLK_v:
+                    Chip8.Key[0xF] = 0;
+                    TRACE_INPUT("Key %X released\n", 0xF);
+                    break;
+
+                default:
+                    TRACE_INPUT("Key Not For Emulator\n", 0);
+                    break;
+                }
+            }
+        }
+
+        // Emulate What Real Time Is Owed, Stopping At Each Frame Boundary For The Input Log & Trace Marker
+        int due = PacingDue();
+        while (due > 0)
+        {
+            if (framePosition == 0)
+            {
+                // Keys Are Fixed For The Whole Frame From Here (Logged Or Replaced By The Log)
+                if (!InputLogFrame(Frames))
+                {
+                    run = false;
+                    break;
+                }
+
+                // Mark Frame Boundary In Execution Trace
+                if (ExecTraceActive)
+                {
+                    ExecTraceFrame();
+                }
+            }
+
+            int instructions = InstructionsPerFrame - framePosition;
+            if (instructions > due)
+            {
+                instructions = due;
+            }
+            RunInstructions(instructions);
+            due -= instructions;
+
+            framePosition += instructions;
+            if (framePosition == InstructionsPerFrame)
+            {
+                framePosition = 0;
+                Frames++;
+
+                // A New Budget Starts On The Next Frame, Whole Frames Still Owed Are Run At It
+                if (TuningActive)
+                {
+                    int tuned = TuningFrame(InstructionsPerFrame);
+                    if (tuned != InstructionsPerFrame)
+                    {
+                        due = due / InstructionsPerFrame * tuned + due % InstructionsPerFrame;
+                        SetInstructionsPerFrame(tuned);
+                    }
+                }
+            }
+        }
+
+        if (FastForward && SDL_GetTicks() - speedTicks >= 1000)
+        {
+            char title[32];
+            snprintf(title, sizeof(title), "Fast Forward %.1fx",
+                     (Frames - speedFrames) * 1000.0 / EMULATION_SPEED / (SDL_GetTicks() - speedTicks));
+            SDL_SetWindowTitle(window, title);
+            speedTicks = SDL_GetTicks();
+            speedFrames = Frames;
+        }
+
+        // Fast Forward Only Draws Once Per Display Interval, Skipping The Frames In Between. A Host Frame
+        // That Changed Nothing On Screen Skips The Upload, The Draw & The Present
+        bool presented = false;
+        if (PacingPresentDue() && (DisplayDirty != 0 || redraw))
+        {
+            // One Upload Of The Changed Rows & One Draw Call, Whatever The Window Size
+            if (Upscaler != NULL)
+            {
+                UpdateUpscaledTexture(texture, textureScale);
+            }
+            else
+            {
+                UpdateDisplayTexture(texture, redraw ? ~0u >> (32 - GRID_HEIGHT) : DisplayDirty);
+            }
+            DisplayDirty = 0;
+            redraw = false;
+
+            SDL_RenderClear(renderer);
+            SDL_RenderCopy(renderer, texture, NULL, &screen);
+            SDL_RenderPresent(renderer);
+            presented = true;
+            Presents++;
+        }
+        else
+        {
+            PresentsSkipped++;
+        }
+
+        // Hold The Frame Rate Against Absolute Deadlines
+        PacingWait(presented);
+    }
+
+    InputLogClose(Frames);
+    TRACE_STOP();
+    SDL_CloseAudio();
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+}
+
+bool ParseArguments(int argc, char **argv)
+{
+    Options.ROM = NULL;
+    Options.ExecTraceFile = NULL;
+    Options.Profile = NULL;
+    Options.RecordFile = NULL;
+    Options.ReplayFile = NULL;
+    Options.Upscaler = NULL;
+    Options.Seed = DEFAULT_SEED;
+    Options.Deterministic = false;
+    Options.DisplaySync = false;
+    Options.FastForward = false;
+    Options.Speed = 0;
+    Options.AutoIpf = false;
+    Options.Jit = false;
+    Options.JitVerify = false;
+    Options.Closure = false;
+    Options.Vip = false;
+    Options.Stats = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        // -b <file> - Write Binary Execution Trace
+        if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+        {
+            Options.ExecTraceFile = argv[++i];
+        }
+
+#ifndef AOT
+        // -j - Compile Hot Blocks To Native Code, -J - Also Check Each Block Against The Interpreter
+        else if (strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "-J") == 0)
+        {
+            Options.Jit = true;
+            Options.JitVerify = (argv[i][1] == 'J');
+        }
+
+        // -c - Run Blocks As Pre-Bound Handler Arrays (No Native Code)
+        else if (strcmp(argv[i], "-c") == 0)
+        {
+            Options.Closure = true;
+        }
+
+        // -v - COSMAC VIP Timing: Each Frame Gets The VIP's Machine Cycles Instead Of A Fixed Instruction Count
+        else if (strcmp(argv[i], "-v") == 0)
+        {
+            Options.Vip = true;
+        }
+
+        // -q <profile> - Quirk Profile (retro8, vip, chip48, schip, xochip)
+        else if (strcmp(argv[i], "-q") == 0 && i + 1 < argc)
+        {
+            Options.Profile = argv[++i];
+        }
+#endif
+
+        // -d <seed> - Deterministic Run: CXNN Starts From seed & The State Hash Is Printed On Exit
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+        {
+            Options.Seed = strtoull(argv[++i], NULL, 0);
+            Options.Deterministic = true;
+        }
+
+        // -r <file> - Record The Seed & Per-Frame Keys, -p <file> - Play Them Back Instead Of The Keyboard
+        else if ((strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "-p") == 0) && i + 1 < argc &&
+                 Options.RecordFile == NULL && Options.ReplayFile == NULL)
+        {
+            if (argv[i][1] == 'r')
+            {
+                Options.RecordFile = argv[++i];
+            }
+            else
+            {
+                Options.ReplayFile = argv[++i];
+            }
+            Options.Deterministic = true;
+        }
+
+        // -u <filter> - Upscale The Display In Software (scale2x, scale3x, scale4x, smooth)
+        else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc)
+        {
+            Options.Upscaler = argv[++i];
+        }
+
+        // -y - Sync To The Display, Each Refresh Runs The Instructions Its Real Time Was Worth
+        else if (strcmp(argv[i], "-y") == 0)
+        {
+            Options.DisplaySync = true;
+        }
+
+        // -f <speed> - Start In Fast Forward At speed Times Real Time (0 = Unlimited), Tab Toggles It
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+        {
+            Options.Speed = atoi(argv[++i]);
+            Options.FastForward = true;
+            if (Options.Speed < 0)
+            {
+                return false;
+            }
+        }
+
+        // -a - Auto Tune Instructions Per Frame For This ROM, Cached Once Settled
+        else if (strcmp(argv[i], "-a") == 0)
+        {
+            Options.AutoIpf = true;
+        }
+
+        // -s - Report Fused Sequences & Elided Idle Cycles On Exit
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            Options.Stats = true;
+        }
+
+        // ROM Path (Only One Allowed)
+        else if (argv[i][0] != '-' && Options.ROM == NULL)
+        {
+            Options.ROM = argv[i];
+        }
+
+        else
+        {
+            return false;
+        }
+    }
+#ifdef AOT
+    // The ROM Is Compiled In
+    return Options.ROM == NULL;
+#else
+    return Options.ROM != NULL;
+#endif
+}
+
+// Load The ROM Given On The Command Line, Or The One Compiled In By chip8-aot
+int LoadProgram()
+{
+#ifdef AOT
+    AotInitialize();
+    return 0;
+#else
+    return LoadROM(Options.ROM);
+#endif
+}
+
+// Seed CXNN: From The Log Being Replayed, From -d, Or From The Clock For Ordinary Play
+bool SeedProgram()
+{
+    if (Options.ReplayFile != NULL && !InputLogOpen(Options.ReplayFile, true, &Options.Seed))
+    {
+        return false;
+    }
+    if (!Options.Deterministic)
+    {
+        Options.Seed = SDL_GetPerformanceCounter();
+    }
+    if (Options.RecordFile != NULL && !InputLogOpen(Options.RecordFile, false, &Options.Seed))
+    {
+        return false;
+    }
+
+    SeedRandom(Options.Seed);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (!ParseArguments(argc, argv))
+    {
+#ifdef AOT
+        printf("Usage: %s [-b <trace_file>] [-s] [-y] [-a] [-u <filter>] [-f <speed>] [-d <seed>] [-r | -p <input_log>] (ROM: %s)\n", argv[0], AotROMName);
+#else
+        printf("Usage: %s [-b <trace_file>] [-s] [-y] [-a] [-u <filter>] [-f <speed>] [-d <seed>] [-r | -p <input_log>] [-j | -J | -c | -v] [-q <profile>] <file_path_name> \n", argv[0]);
+#endif
+    }
+    else if (Options.Profile != NULL && !SelectProfile(Options.Profile))
+    {
+        printf("Unknown Quirk Profile: %s (retro8, vip, chip48, schip, xochip)\n", Options.Profile);
+    }
+    else if (Options.Upscaler != NULL && !SelectUpscaler(Options.Upscaler))
+    {
+        printf("Unknown Upscaler: %s (scale2x, scale3x, scale4x, smooth)\n", Options.Upscaler);
+    }
+    else
+    {
+        InitializeChip8();
+        InitializeOpcodeTables();
+        ClearDisplay();
+
+        if (LoadProgram() == 0 && SeedProgram())
+        {
+            if (Options.ExecTraceFile != NULL)
+            {
+                ExecTraceOpen(Options.ExecTraceFile);
+            }
+
+            // VIP Timing & Input Logs Work In Whole Frames, Which Only The Fixed Timestep Guarantees
+            if (Options.DisplaySync && (Options.Vip || Options.Deterministic))
+            {
+                printf("Display Sync: Disabled With %s\n", Options.Vip ? "VIP Timing" : "A Deterministic Run");
+                Options.DisplaySync = false;
+            }
+
+            // VIP Timing Has Its Own Frame Length & A Cached Budget Would Change What A Seed Replays
+            if (Options.AutoIpf && (Options.Vip || Options.Deterministic))
+            {
+                printf("Auto IPF: Disabled With %s\n", Options.Vip ? "VIP Timing" : "A Deterministic Run");
+                Options.AutoIpf = false;
+            }
+            else if (Options.AutoIpf)
+            {
+                InstructionsPerFrame = TuningStart(INSTRUCTIONS_PER_FRAME);
+                SetTickCycles(InstructionsPerFrame);
+            }
+
+            StartTier(Options.Vip, Options.Jit, Options.JitVerify, Options.Closure);
+            Run();
+            StopTier();
+            ExecTraceClose();
+
+            // Two Runs With The Same Seed & Input Log Print The Same Hash
+            if (Options.Deterministic)
+            {
+                printf("State Hash: %016llx After %llu Frames (Seed %llu)\n", (unsigned long long)StateHash(),
+                       (unsigned long long)Frames, (unsigned long long)Options.Seed);
+            }
+
+            if (Options.Stats)
+            {
+                PacingReport(Frames);
+                printf("Display: %llu Host Frames Presented, %llu Skipped (%s Expansion)\n",
+                       (unsigned long long)Presents, (unsigned long long)PresentsSkipped, ExpandKernelName());
+                FusionReport();
+                printf("Idle Loops: %llu Cycles Elided\n", (unsigned long long)IdleCyclesElided);
+                if (Options.AutoIpf)
+                {
+                    TuningReport(InstructionsPerFrame);
+                }
+                if (VipActive)
+                {
+                    printf("VIP Timing: %llu Instructions In %llu Machine Cycles\n", (unsigned long long)VipInstructions,
+                           (unsigned long long)Chip8.Cycles);
+                }
+            }
+        }
+    }
+    return 0;
+}
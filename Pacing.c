@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <SDL2/SDL.h>
+#include "Pacing.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <time.h>
+#endif
+
+#define NS_PER_SECOND 1000000000ULL
+
+static int Hz;
+static int InstructionsPerFrame;
+static bool DisplaySync;
+static int Speed = 1;
+
+// Emulated Time Owed, In Units Of 1 / (Hz * InstructionsPerFrame) ns So Frames & Instructions Are Both Whole:
+// One Instruction Is NS_PER_SECOND Units, One Frame InstructionsPerFrame Times That
+static uint64_t Accumulator;
+static uint64_t Last;
+
+// Start Of The Run & The Last Present (For The Speed Ratio & Fast Forward Frame Skip)
+static uint64_t Started;
+static uint64_t Presented;
+
+// Interval Each Host Frame Should Take (One Emulated Frame, Or One Display Refresh When Synced)
+static uint64_t Expected;
+
+// Jitter Report (Skips The Interval Before The First Host Frame & After A Resync)
+static bool Measuring = false;
+static uint64_t LateFrames = 0;
+static uint64_t DroppedFrames = 0;
+static uint64_t DeviationSum = 0;
+static uint64_t DeviationMax = 0;
+static uint64_t Histogram[PACING_BUCKETS];
+
+// Monotonic Nanoseconds
+static uint64_t Now()
+{
+#ifdef __linux__
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * NS_PER_SECOND + now.tv_nsec;
+#else
+    uint64_t counter = SDL_GetPerformanceCounter();
+    uint64_t frequency = SDL_GetPerformanceFrequency();
+    return counter / frequency * NS_PER_SECOND + counter % frequency * NS_PER_SECOND / frequency;
+#endif
+}
+
+// Sleep To An Absolute Deadline, So Time Spent Executing & Rendering Never Adds Up Into Drift
+static void SleepUntil(uint64_t deadline)
+{
+#ifdef __linux__
+    struct timespec until = {(time_t)(deadline / NS_PER_SECOND), (long)(deadline % NS_PER_SECOND)};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, NULL) == EINTR)
+    {
+    }
+#else
+    // SDL_Delay Only Has Millisecond Resolution & Oversleeps, Stop 2ms Short & Spin The Rest
+    uint64_t now = Now();
+    if (deadline > now + 2000000)
+    {
+        SDL_Delay((Uint32)((deadline - now) / 1000000 - 2));
+    }
+    while (Now() < deadline)
+    {
+    }
+#endif
+}
+
+void PacingStart(int hz, int instructionsPerFrame, bool displaySync, int refreshRate)
+{
+    Hz = hz;
+    InstructionsPerFrame = instructionsPerFrame;
+    DisplaySync = displaySync;
+    Expected = NS_PER_SECOND / ((displaySync && refreshRate > 0) ? refreshRate : hz);
+    Accumulator = 0;
+    Last = Now();
+    Started = Last;
+    Presented = Last;
+}
+
+// Instructions To Run This Host Frame. Whole Frames On A Fixed Timestep, Catching Up At Most PACING_MAX_FRAMES
+int PacingDue()
+{
+    uint64_t now = Now();
+    uint64_t elapsed = now - Last;
+    uint64_t frame = NS_PER_SECOND * InstructionsPerFrame;
+    Last = now;
+
+    if (Speed == 0)
+    {
+        return PACING_UNLIMITED_FRAMES * InstructionsPerFrame;
+    }
+
+    // Jitter Is Measured Against The Interval The Host Frame Was Meant To Take (Real Time Only)
+    if (Measuring && Speed == 1)
+    {
+        uint64_t deviation = (elapsed > Expected) ? elapsed - Expected : Expected - elapsed;
+        uint64_t bucket = deviation / PACING_BUCKET_NS;
+
+        DeviationSum += deviation;
+        DeviationMax = (deviation > DeviationMax) ? deviation : DeviationMax;
+        Histogram[(bucket < PACING_BUCKETS) ? bucket : PACING_BUCKETS - 1]++;
+        if (elapsed > Expected + 1000000)
+        {
+            LateFrames++;
+        }
+    }
+    Measuring = true;
+
+    // Spiral Of Death: Never Owe More Than PACING_MAX_FRAMES (Per Speed Step), Whatever Is Older Is Dropped
+    uint64_t limit = (uint64_t)PACING_MAX_FRAMES * Speed;
+    Accumulator += elapsed * Hz * InstructionsPerFrame * Speed;
+    if (Accumulator > limit * frame)
+    {
+        DroppedFrames += Accumulator / frame - limit;
+        Accumulator = limit * frame + Accumulator % frame;
+    }
+
+    // Fast Forward Skips Presents, So It Can't Lean On The Display To Wait
+    uint64_t instructions;
+    if (DisplaySync && Speed == 1)
+    {
+        instructions = Accumulator / NS_PER_SECOND;
+    }
+    else
+    {
+        instructions = Accumulator / frame * InstructionsPerFrame;
+    }
+    Accumulator -= instructions * NS_PER_SECOND;
+    return (int)instructions;
+}
+
+// Sleep Until The Next Emulated Frame Is Owed. Synced To The Display, Presenting Already Waited For The
+// Refresh, A Host Frame That Had Nothing New To Present Sleeps Out The Refresh Interval Here Instead
+void PacingWait(bool presented)
+{
+    if (DisplaySync && Speed == 1)
+    {
+        if (!presented)
+        {
+            SleepUntil(Last + Expected);
+        }
+        return;
+    }
+    if (Speed == 0)
+    {
+        return;
+    }
+
+    uint64_t frame = NS_PER_SECOND * InstructionsPerFrame;
+    uint64_t rate = (uint64_t)Hz * InstructionsPerFrame * Speed;
+    SleepUntil(Last + (frame - Accumulator + rate - 1) / rate);
+}
+
+// Forget Time Spent Blocked (Waiting On A Key With No Timer Running), Nothing Was Owed For It
+void PacingResync()
+{
+    Accumulator = 0;
+    Last = Now();
+    Measuring = false;
+}
+
+void PacingSetSpeed(int speed)
+{
+    Speed = speed;
+    PacingResync();
+}
+
+// Rescale What's Owed, So The Same Emulated Time Carries Over Into Frames Of The New Length
+void PacingSetInstructionsPerFrame(int instructionsPerFrame)
+{
+    Accumulator = Accumulator * instructionsPerFrame / InstructionsPerFrame;
+    InstructionsPerFrame = instructionsPerFrame;
+}
+
+// Every Frame Is Shown At Real Time. Faster, Frames Are Skipped Down To One Per Display Interval
+bool PacingPresentDue()
+{
+    uint64_t now = Now();
+    if (Speed == 1)
+    {
+        return true;
+    }
+
+    // Stay On The Display Interval Grid, So Presents Don't Drift Behind It
+    if (now - Presented >= Expected)
+    {
+        Presented = now - (now - Presented) % Expected;
+        return true;
+    }
+    return false;
+}
+
+// Jitter Of Real Time Host Frames & The Emulated Versus Wall Clock Speed Over The Whole Run
+void PacingReport(uint64_t frames)
+{
+    double seconds = (Now() - Started) / 1e9;
+    if (seconds > 0)
+    {
+        printf("Speed: %.2fx Real Time (%llu Frames In %.2f s)\n", frames / (double)Hz / seconds, (unsigned long long)frames,
+               seconds);
+    }
+
+    uint64_t measured = 0;
+    for (int i = 0; i < PACING_BUCKETS; i++)
+    {
+        measured += Histogram[i];
+    }
+    if (measured == 0)
+    {
+        return;
+    }
+
+    // 99th Percentile From The Histogram (Upper Edge Of Its Bucket)
+    uint64_t seen = 0;
+    int p99 = 0;
+    while (p99 < PACING_BUCKETS - 1 && (seen += Histogram[p99]) * 100 < measured * 99)
+    {
+        p99++;
+    }
+
+    printf("Frame Pacing: %llu Host Frames, Jitter Mean %.3f ms, 99%% < %.3f ms, Max %.3f ms, %llu Late, %llu Frames Dropped\n",
+           (unsigned long long)measured, DeviationSum / (double)measured / 1e6, (p99 + 1) * PACING_BUCKET_NS / 1e6,
+           DeviationMax / 1e6, (unsigned long long)LateFrames, (unsigned long long)DroppedFrames);
+}
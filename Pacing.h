@@ -0,0 +1,29 @@
+#ifndef PACING_H
+#define PACING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Most Emulated Frames Made Up In One Host Frame, Anything Further Behind Is Dropped
+#define PACING_MAX_FRAMES 4
+
+// Unlimited Speed: Emulated Frames Per Host Frame (Between Event Polls)
+#define PACING_UNLIMITED_FRAMES 64
+
+// Jitter Histogram: Buckets Of 50us, The Last One Collects Everything From 20ms Up
+#define PACING_BUCKET_NS 50000
+#define PACING_BUCKETS 400
+
+// Fixed Timestep: Whole Emulated Frames On Absolute Deadlines. Display Sync: The Renderer
+// Waits For The Display & Each Host Frame Runs The Instructions Its Real Time Was Worth.
+// Speed: 1 = Real Time, N = N Times Faster, 0 = As Fast As The Host Goes
+void PacingStart(int hz, int instructionsPerFrame, bool displaySync, int refreshRate);
+int PacingDue();
+void PacingWait(bool presented);
+void PacingResync();
+void PacingSetSpeed(int speed);
+void PacingSetInstructionsPerFrame(int instructionsPerFrame);
+bool PacingPresentDue();
+void PacingReport(uint64_t frames);
+
+#endif
@@ -0,0 +1,582 @@
+// Quirk-Specialized Interpreter, Included Once Per Profile By Quirks.c (So No Include Guard).
+// PROFILE Names The Profile, VARIANT(Name) Gives Its Symbol Names & QUIRK(Q) Its Compile-Time Flags,
+// So Each Copy Is Built With Its Quirks Folded In And Nothing Checks Them At Run Time.
+
+// 8XY1 - SET Vx |= Vy
+void VARIANT(Op_8XY1)(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 8XY1 - SET Vx |= NN %04x\n", D);
+    Chip8.V[D->X] = Chip8.V[D->X] | Chip8.V[D->Y];
+    if (QUIRK(RESET_VF))
+    {
+        Chip8.V[0xF] = 0;
+    }
+}
+
+// 8XY2 - SET Vx &= Vy
+void VARIANT(Op_8XY2)(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 8XY2 - SET Vx &= Vy %04x\n", D);
+    Chip8.V[D->X] = Chip8.V[D->X] & Chip8.V[D->Y];
+    if (QUIRK(RESET_VF))
+    {
+        Chip8.V[0xF] = 0;
+    }
+}
+
+// 8XY3 - SET Vx ^= Vy
+void VARIANT(Op_8XY3)(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x 8XY3 - SET Vx ^= Vy %04x\n", D);
+    Chip8.V[D->X] = Chip8.V[D->X] ^ Chip8.V[D->Y];
+    if (QUIRK(RESET_VF))
+    {
+        Chip8.V[0xF] = 0;
+    }
+}
+
+// 8XY6 - SET Vx >>= 1 (Or Vx = Vy >> 1)
+void VARIANT(Op_8XY6)(DecodedInstruction *D)
+{
+    uint8_t S = QUIRK(SHIFT_VY) ? D->Y : D->X;
+
+    if (QUIRK(SHIFT_FLAG_FIRST))
+    {
+        // Set Flag of LSB
+        Chip8.V[0xF] = Chip8.V[S] & 1;
+
+        // Shift Right
+        Chip8.V[D->X] = Chip8.V[S] >> 1;
+    }
+    else
+    {
+        uint8_t flag = Chip8.V[S] & 1;
+        Chip8.V[D->X] = Chip8.V[S] >> 1;
+        Chip8.V[0xF] = flag;
+    }
+}
+
+// 8XYE - SET Vx <<= 1 (Or Vx = Vy << 1)
+void VARIANT(Op_8XYE)(DecodedInstruction *D)
+{
+    uint8_t S = QUIRK(SHIFT_VY) ? D->Y : D->X;
+
+    if (QUIRK(SHIFT_FLAG_FIRST))
+    {
+        // Flag
+        Chip8.V[0xF] = Chip8.V[S] >> 7;
+
+        // Shift
+        Chip8.V[D->X] = Chip8.V[S] << 1;
+    }
+    else
+    {
+        uint8_t flag = Chip8.V[S] >> 7;
+        Chip8.V[D->X] = Chip8.V[S] << 1;
+        Chip8.V[0xF] = flag;
+    }
+}
+
+// BNNN - SET PC = V0 + NNN (Or BXNN - SET PC = Vx + NNN)
+void VARIANT(Op_BNNN)(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x BNNN - SET PC = V0 + NNN %04x\n", D);
+    Chip8.PC = Chip8.V[QUIRK(JUMP_VX) ? D->X : 0x0] + D->NNN;
+}
+
+void VARIANT(DrawSprite)(uint8_t X, uint8_t Y, uint8_t N)
+{
+    // Make Copy of Vx & Vy (As I Wipe Vf to 0 )
+    uint8_t Vx = Chip8.V[X];
+    uint8_t Vy = Chip8.V[Y];
+
+    // Clear the collision flag
+    Chip8.V[0xF] = 0;
+    SpritesDrawn++;
+
+    // Rows Are Read From A Masked I, The Ones Past 0xFFF Come From The Guard
+    uint16_t sprite = MEMORY_ADDRESS(Chip8.I, N);
+
+    // Clipping: Only The Starting Position Wraps, Pixels Past The Edges Are Dropped
+    if (QUIRK(CLIP))
+    {
+        Vx %= GRID_WIDTH;
+        Vy %= GRID_HEIGHT;
+    }
+
+    // Iterate over each line of the sprite
+    for (int line = 0; line < N; line++)
+    {
+        if (QUIRK(CLIP) && Vy + line >= GRID_HEIGHT)
+        {
+            break;
+        }
+
+        // Sprite Byte Over Pixels 0-7, Moved Along To Vx: Shifted Past The Right Edge When Clipping,
+        // Rotated Back Round To The Left Edge When Wrapping
+        uint64_t bits = (uint64_t)Chip8.Memory[sprite + line] << (GRID_WIDTH - 8);
+        uint64_t row;
+        if (QUIRK(CLIP))
+        {
+            row = bits >> Vx;
+        }
+        else
+        {
+            uint8_t shift = Vx % GRID_WIDTH;
+            row = (bits >> shift) | (bits << ((GRID_WIDTH - shift) % GRID_WIDTH));
+        }
+
+        // Collision Is Any Lit Pixel Under The Row, Then The Whole Row XORs In At Once
+        uint8_t y = (Vy + line) % GRID_HEIGHT;
+        if ((Chip8.Display[y] & row) != 0)
+        {
+            Chip8.V[0xF] = 1;
+        }
+        if (row != 0)
+        {
+            Chip8.Display[y] ^= row;
+            DisplayDirty |= 1u << y;
+        }
+    }
+}
+
+// DXYN - DISPLAY draw(Vx, Vy, N)
+void VARIANT(Op_DXYN)(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x DXYN - DISPLAY %04x\n", D);
+    VARIANT(DrawSprite)(D->X, D->Y, D->N);
+}
+
+// FX55 - SET Memory[I + i] = V[i]
+void VARIANT(Op_FX55)(DecodedInstruction *D)
+{
+    uint16_t address = MEMORY_ADDRESS(Chip8.I, D->X + 1);
+    for (int i = 0; i <= D->X; i++)
+    {
+        Chip8.Memory[address + i] = Chip8.V[i];
+    }
+    InvalidateDecoded(address, D->X + 1);
+    Chip8.I += INDEX_STEP(QUIRK(STORE_INDEX), D->X);
+}
+
+// FX65 - SET V[i] = Memory[I + i]
+void VARIANT(Op_FX65)(DecodedInstruction *D)
+{
+    TRACE_OPCODE("%04x FX65 - SET V[i] = Memory[I + i] %04x\n", D);
+    uint16_t address = MEMORY_ADDRESS(Chip8.I, D->X + 1);
+    for (int i = 0; i <= D->X; i++)
+    {
+        Chip8.V[i] = Chip8.Memory[address + i];
+    }
+    Chip8.I += INDEX_STEP(QUIRK(LOAD_INDEX), D->X);
+}
+
+// Batched Interpreter: Runs Up To `instructions` With PC, I, SP, V & Cycles Held In Locals,
+// Writing Them Back Only Around Calls That Need The Global State. Fused Sequences That Fit
+// The Budget Run As One Step & Idle Loops Skip Ahead Until The Timer They Poll Could Let Them Out.
+#define SPILL()                                \
+    Chip8.PC = PC;                             \
+    Chip8.I = I;                               \
+    Chip8.SP = SP;                             \
+    Chip8.Cycles = Cycles;                     \
+    memcpy(Chip8.V, V, sizeof(V))
+
+#define RELOAD()                               \
+    PC = Chip8.PC;                             \
+    I = Chip8.I;                               \
+    SP = Chip8.SP;                             \
+    Cycles = Chip8.Cycles;                     \
+    memcpy(V, Chip8.V, sizeof(V))
+
+static CHIP8_STOP QUIRK_CAT(Run_, PROFILE)(int instructions, int *executed)
+{
+    int budget = instructions;
+    CHIP8_STOP stop = CHIP8_STOP_BUDGET;
+
+    // Halted Time Still Counts Towards The Timers
+    if (WaitingForKey())
+    {
+        Chip8.Cycles += instructions;
+        *executed = instructions;
+        return CHIP8_STOP_KEY_WAIT;
+    }
+
+    // Opcode & Execution Traces Need Every Instruction To Go Through Its Handler
+    if (TRACE_LEVEL >= TRACE_LEVEL_OPCODES || ExecTraceActive)
+    {
+        for (; instructions > 0 && stop == CHIP8_STOP_BUDGET; instructions--)
+        {
+            bool draw = Chip8.PC < MEMORY_SIZE && (Chip8.Memory[Chip8.PC] & 0xF0) == 0xD0;
+            ExecuteInstructions();
+            if (draw)
+            {
+                stop = CHIP8_STOP_DRAW;
+            }
+            else if (Chip8.Halted)
+            {
+                stop = CHIP8_STOP_KEY_WAIT;
+            }
+        }
+        *executed = budget - instructions;
+        return stop;
+    }
+
+    // Full Width Locals Keep The Compiler From Packing PC & I Together, Wrapped Like The Fields They Mirror
+    unsigned int PC;
+    unsigned int I;
+    unsigned int SP;
+    uint64_t Cycles;
+    uint8_t V[16];
+    RELOAD();
+
+    while (instructions > 0)
+    {
+        // Last Byte Of Memory Has No Full Opcode, Leave It To The Single Step Path
+        if (PC >= MEMORY_SIZE - 1)
+        {
+            SPILL();
+            ExecuteInstructions();
+            RELOAD();
+            instructions--;
+            continue;
+        }
+
+        DecodedInstruction *D = &DecodedMemory[PC];
+
+        // Idle Loops & Fusions Ending In A Draw Or Memory Load (Which Start With ANNN / FX1E) Work On
+        // The Global State
+        bool fused = D->Fused != NULL && D->FusedLength <= instructions;
+        bool global = fused && (D->Handler == Op_ANNN || D->Handler == Op_FX1E);
+        if (D->IdleLoop != IDLE_NONE || global)
+        {
+            SPILL();
+            int skipped = (D->IdleLoop != IDLE_NONE) ? SkipIdleLoop(D, instructions) : 0;
+            if (skipped > 0)
+            {
+                instructions -= skipped;
+                RELOAD();
+                continue;
+            }
+            if (global)
+            {
+                int ran = D->Fused(D);
+                Chip8.Cycles += ran;
+                instructions -= ran;
+                RELOAD();
+
+                // A Sequence Ending In DXYN Hands Control Back Like The Draw Below
+                if ((D[2 * (ran - 1)].Opcode >> 12) == 0xD)
+                {
+                    stop = CHIP8_STOP_DRAW;
+                    break;
+                }
+                continue;
+            }
+        }
+
+        // Register-Only Fusions Run Right On The Locals: A Run Of 6XNN Loads, Or A 3XNN / 4XNN Skip Over A
+        // 1NNN Back Edge (Stepping Over The Jump Is 1 Instruction, Taking It Is 2)
+        if (fused && D->Handler == Op_6XNN)
+        {
+            for (int i = 0; i < D->FusedLength; i++)
+            {
+                V[D[2 * i].X] = D[2 * i].NN;
+            }
+            PC += 2 * D->FusedLength;
+            Cycles += D->FusedLength;
+            instructions -= D->FusedLength;
+            FusionFired[FUSION_LOADS]++;
+            continue;
+        }
+        if (fused && (D->Handler == Op_3XNN || D->Handler == Op_4XNN))
+        {
+            bool equal = V[D->X] == D->NN;
+            bool skip = (D->Handler == Op_3XNN) ? equal : !equal;
+            FusionFired[(D->Handler == Op_3XNN) ? FUSION_SKIP_EQ_JUMP : FUSION_SKIP_NE_JUMP]++;
+            PC = skip ? PC + 4 : D[2].NNN;
+            Cycles += skip ? 1 : 2;
+            instructions -= skip ? 1 : 2;
+            continue;
+        }
+
+        if (D->Handler == Op_Decode)
+        {
+            DecodeInstruction(PC, D);
+        }
+
+        uint8_t X = D->X;
+        uint8_t Y = D->Y;
+        PC += 2;
+        Cycles++;
+        instructions--;
+
+        switch (D->Opcode >> 12)
+        {
+        case 0x0:
+            if (D->Opcode == 0x00E0)
+            {
+                ClearDisplay();
+            }
+            else if (D->Opcode == 0x00EE)
+            {
+                if (SP > 0)
+                {
+                    SP--;
+                    PC = Chip8.Stack[STACK_INDEX(SP)];
+                }
+                else
+                {
+                    printf("Error: Stack underflow at PC %04x\n", PC);
+                }
+            }
+            break;
+
+        case 0x1:
+            PC = D->NNN;
+            break;
+
+        case 0x2:
+            Chip8.Stack[STACK_INDEX(SP)] = PC;
+            SP = (SP + 1) & 0xFF;
+            PC = D->NNN;
+            break;
+
+        case 0x3:
+            PC += (V[X] == D->NN) ? 2 : 0;
+            break;
+
+        case 0x4:
+            PC += (V[X] != D->NN) ? 2 : 0;
+            break;
+
+        case 0x5:
+            PC += (D->N == 0 && V[X] == V[Y]) ? 2 : 0;
+            break;
+
+        case 0x6:
+            V[X] = D->NN;
+            break;
+
+        case 0x7:
+            V[X] += D->NN;
+            break;
+
+        case 0x8:
+            switch (D->N)
+            {
+            case 0x0:
+                V[X] = V[Y];
+                break;
+
+            case 0x1:
+                V[X] |= V[Y];
+                if (QUIRK(RESET_VF))
+                {
+                    V[0xF] = 0;
+                }
+                break;
+
+            case 0x2:
+                V[X] &= V[Y];
+                if (QUIRK(RESET_VF))
+                {
+                    V[0xF] = 0;
+                }
+                break;
+
+            case 0x3:
+                V[X] ^= V[Y];
+                if (QUIRK(RESET_VF))
+                {
+                    V[0xF] = 0;
+                }
+                break;
+
+            case 0x4:
+            {
+                uint16_t sum = V[X] + V[Y];
+                V[X] = sum & 0xFF;
+                V[0xF] = (sum > 255) ? 1 : 0;
+                break;
+            }
+
+            case 0x5:
+            {
+                uint8_t Vx = V[X];
+                uint8_t Vy = V[Y];
+                V[X] = Vx - Vy;
+                V[0xF] = (Vx >= Vy) ? 1 : 0;
+                break;
+            }
+
+            case 0x6:
+            {
+                uint8_t S = QUIRK(SHIFT_VY) ? Y : X;
+                if (QUIRK(SHIFT_FLAG_FIRST))
+                {
+                    V[0xF] = V[S] & 1;
+                    V[X] = V[S] >> 1;
+                }
+                else
+                {
+                    uint8_t flag = V[S] & 1;
+                    V[X] = V[S] >> 1;
+                    V[0xF] = flag;
+                }
+                break;
+            }
+
+            case 0x7:
+                V[X] = V[Y] - V[X];
+                V[0xF] = (V[Y] >= V[X]) ? 1 : 0;
+                break;
+
+            case 0xE:
+            {
+                uint8_t S = QUIRK(SHIFT_VY) ? Y : X;
+                if (QUIRK(SHIFT_FLAG_FIRST))
+                {
+                    V[0xF] = V[S] >> 7;
+                    V[X] = V[S] << 1;
+                }
+                else
+                {
+                    uint8_t flag = V[S] >> 7;
+                    V[X] = V[S] << 1;
+                    V[0xF] = flag;
+                }
+                break;
+            }
+            }
+            break;
+
+        case 0x9:
+            PC += (D->N == 0 && V[X] != V[Y]) ? 2 : 0;
+            break;
+
+        case 0xA:
+            I = D->NNN;
+            break;
+
+        case 0xB:
+            PC = V[QUIRK(JUMP_VX) ? X : 0x0] + D->NNN;
+            break;
+
+        case 0xC:
+            V[X] = NextRandom() & D->NN;
+            break;
+
+        case 0xD:
+            // Draw Works On The Global State, Then Hand Control Back To Present The Frame
+            SPILL();
+            VARIANT(DrawSprite)(X, Y, D->N);
+            RELOAD();
+            stop = CHIP8_STOP_DRAW;
+            break;
+
+        case 0xE:
+            if (D->NN == 0x9E)
+            {
+                PC += (Chip8.Key[V[X] & 0xF] != 0) ? 2 : 0;
+            }
+            else if (D->NN == 0xA1)
+            {
+                PC += (Chip8.Key[V[X] & 0xF] == 0) ? 2 : 0;
+            }
+            break;
+
+        case 0xF:
+            switch (D->NN)
+            {
+            case 0x07:
+                V[X] = ReadTimer(&Chip8.Delay_Timer, Cycles);
+                break;
+
+            case 0x0A:
+                SPILL();
+                Op_FX0A(D);
+                RELOAD();
+                if (Chip8.Halted)
+                {
+                    stop = CHIP8_STOP_KEY_WAIT;
+                }
+                break;
+
+            case 0x15:
+                WriteTimer(&Chip8.Delay_Timer, V[X], Cycles);
+                break;
+
+            case 0x18:
+                WriteTimer(&Chip8.Sound_Timer, V[X], Cycles);
+                break;
+
+            case 0x1E:
+                I = (I + V[X]) & 0xFFFF;
+                break;
+
+            case 0x29:
+                I = V[X] * 5;
+                break;
+
+            case 0x33:
+            {
+                unsigned int address = MEMORY_ADDRESS(I, 3);
+                Chip8.Memory[address] = V[X] / 100;
+                Chip8.Memory[address + 1] = (V[X] / 10) % 10;
+                Chip8.Memory[address + 2] = V[X] % 10;
+                InvalidateDecoded(address, 3);
+                break;
+            }
+
+            case 0x55:
+            {
+                unsigned int address = MEMORY_ADDRESS(I, X + 1);
+                for (int i = 0; i <= X; i++)
+                {
+                    Chip8.Memory[address + i] = V[i];
+                }
+                InvalidateDecoded(address, X + 1);
+                I = (I + INDEX_STEP(QUIRK(STORE_INDEX), X)) & 0xFFFF;
+                break;
+            }
+
+            case 0x65:
+            {
+                unsigned int address = MEMORY_ADDRESS(I, X + 1);
+                for (int i = 0; i <= X; i++)
+                {
+                    V[i] = Chip8.Memory[address + i];
+                }
+                I = (I + INDEX_STEP(QUIRK(LOAD_INDEX), X)) & 0xFFFF;
+                break;
+            }
+            }
+            break;
+        }
+
+        if (stop != CHIP8_STOP_BUDGET)
+        {
+            break;
+        }
+    }
+
+    SPILL();
+    *executed = budget - instructions;
+    return stop;
+}
+
+#undef SPILL
+#undef RELOAD
+
+const CHIP8_PROFILE QUIRK_CAT(Profile_, PROFILE) = {
+    QUIRK_STRING(PROFILE),
+    VARIANT(Op_8XY1),
+    VARIANT(Op_8XY2),
+    VARIANT(Op_8XY3),
+    VARIANT(Op_8XY6),
+    VARIANT(Op_8XYE),
+    VARIANT(Op_BNNN),
+    VARIANT(Op_DXYN),
+    VARIANT(Op_FX55),
+    VARIANT(Op_FX65),
+    QUIRK_CAT(Run_, PROFILE)};
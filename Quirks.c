@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "CHIP8.h"
+#include "Trace.h"
+#include "ExecTrace.h"
+#include "Fusion.h"
+#include "Idle.h"
+#include "Quirks.h"
+
+// Each Profile's Flags As Compile-Time Constants (RETRO8_SHIFT_VY, VIP_CLIP, ...)
+#define PROFILE_FLAGS(Name, ShiftVy, ShiftFlagFirst, StoreIndex, LoadIndex, JumpVx, Clip, ResetVF) \
+    enum                                                                                           \
+    {                                                                                              \
+        Name##_SHIFT_VY = ShiftVy,                                                                 \
+        Name##_SHIFT_FLAG_FIRST = ShiftFlagFirst,                                                  \
+        Name##_STORE_INDEX = StoreIndex,                                                           \
+        Name##_LOAD_INDEX = LoadIndex,                                                             \
+        Name##_JUMP_VX = JumpVx,                                                                   \
+        Name##_CLIP = Clip,                                                                        \
+        Name##_RESET_VF = ResetVF                                                                  \
+    };
+CHIP8_PROFILES(PROFILE_FLAGS)
+#undef PROFILE_FLAGS
+
+#define QUIRK_PASTE(A, B) A##B
+#define QUIRK_CAT(A, B) QUIRK_PASTE(A, B)
+#define QUIRK_QUOTE(A) #A
+#define QUIRK_STRING(A) QUIRK_QUOTE(A)
+#define QUIRK(Q) QUIRK_CAT(PROFILE, QUIRK_CAT(_, Q))
+#define INDEX_STEP(Mode, X) ((int)(Mode) == INDEX_PAST_LAST ? (X) + 1 : (int)(Mode) == INDEX_ON_LAST ? (X) : 0)
+
+// Retro8's Own Behaviour Keeps The Plain Handler Names The Other Tiers Recognize
+#define PROFILE RETRO8
+#define VARIANT(Name) Name
+#include "QuirkVariant.h"
+#undef VARIANT
+#undef PROFILE
+
+#define PROFILE VIP
+#define VARIANT(Name) Name##_VIP
+#include "QuirkVariant.h"
+#undef VARIANT
+#undef PROFILE
+
+#define PROFILE CHIP48
+#define VARIANT(Name) Name##_CHIP48
+#include "QuirkVariant.h"
+#undef VARIANT
+#undef PROFILE
+
+#define PROFILE SCHIP
+#define VARIANT(Name) Name##_SCHIP
+#include "QuirkVariant.h"
+#undef VARIANT
+#undef PROFILE
+
+#define PROFILE XOCHIP
+#define VARIANT(Name) Name##_XOCHIP
+#include "QuirkVariant.h"
+#undef VARIANT
+#undef PROFILE
+
+#define PROFILE_ENTRY(Name, ...) &Profile_##Name,
+const CHIP8_PROFILE *const Profiles[] = {CHIP8_PROFILES(PROFILE_ENTRY)};
+#undef PROFILE_ENTRY
+
+const CHIP8_PROFILE *Profile = &Profile_RETRO8;
+
+// Pick A Profile By Name (Any Case), Before InitializeOpcodeTables & LoadROM
+bool SelectProfile(const char *name)
+{
+    for (size_t p = 0; p < sizeof(Profiles) / sizeof(Profiles[0]); p++)
+    {
+        const char *a = Profiles[p]->Name;
+        const char *b = name;
+        while (*a != '\0' && toupper((unsigned char)*b) == *a)
+        {
+            a++;
+            b++;
+        }
+        if (*a == '\0' && *b == '\0')
+        {
+            Profile = Profiles[p];
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,46 @@
+#ifndef QUIRKS_H
+#define QUIRKS_H
+
+#include <stdbool.h>
+#include "CHIP8.h"
+
+// Where FX55 / FX65 Leave I
+enum
+{
+    INDEX_KEEP,      // Unchanged
+    INDEX_PAST_LAST, // I += X + 1
+    INDEX_ON_LAST    // I += X
+};
+
+// Quirk Profiles, One Specialized Interpreter Each (See QuirkVariant.h):
+// Name, 8XY6/8XYE Shift Vy, Shift Writes VF First, FX55 Index, FX65 Index, BXNN Jumps To VX + NNN, Clip Sprites, 8XY1-3 Reset VF
+#define CHIP8_PROFILES(P)                                                  \
+    P(RETRO8, 0, 1, INDEX_PAST_LAST, INDEX_KEEP, 0, 0, 0)                  \
+    P(VIP, 1, 0, INDEX_PAST_LAST, INDEX_PAST_LAST, 0, 1, 1)                \
+    P(CHIP48, 0, 0, INDEX_ON_LAST, INDEX_ON_LAST, 1, 1, 0)                 \
+    P(SCHIP, 0, 0, INDEX_KEEP, INDEX_KEEP, 1, 1, 0)                        \
+    P(XOCHIP, 1, 0, INDEX_PAST_LAST, INDEX_PAST_LAST, 0, 0, 0)
+
+// Handlers For The Opcodes That Differ Between Profiles & The Batched Loop Built For Them
+typedef struct
+{
+    const char *Name;
+    OpcodeHandler Or;
+    OpcodeHandler And;
+    OpcodeHandler Xor;
+    OpcodeHandler ShiftRight;
+    OpcodeHandler ShiftLeft;
+    OpcodeHandler Jump;
+    OpcodeHandler Draw;
+    OpcodeHandler Store;
+    OpcodeHandler Load;
+    CHIP8_STOP (*Run)(int instructions, int *executed);
+
+} CHIP8_PROFILE;
+
+// Active Profile (RETRO8 Unless Another Is Selected Before The Opcode Tables Are Built)
+extern const CHIP8_PROFILE *Profile;
+
+bool SelectProfile(const char *name);
+
+#endif
@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include "CHIP8.h"
+#include "ExecTrace.h"
+#include "Jit.h"
+#include "Closure.h"
+#include "Vip.h"
+#include "Runner.h"
+#ifdef AOT
+#include "Aot.h"
+#endif
+
+// After The Program Is Loaded & Any Execution Trace Is Open
+void StartTier(bool vip, bool jit, bool jitVerify, bool closure)
+{
+    // VIP Timing Charges Each Instruction As It Runs, So It Keeps The Interpreter
+    if (vip)
+    {
+        VipInitialize();
+    }
+
+    // Execution Traces Need Every Instruction, So They Keep The Interpreter
+    else if ((jit || closure) && ExecTraceActive)
+    {
+        printf("%s: Disabled While Writing An Execution Trace\n", jit ? "JIT" : "Closure Tier");
+    }
+    else if (jit)
+    {
+        JitInitialize(jitVerify);
+    }
+    else if (closure)
+    {
+        ClosureInitialize();
+    }
+}
+
+// Run Instructions On The Active Tier (VIP Timing Runs A Whole Frame Of Machine Cycles Instead)
+void RunInstructions(int instructions)
+{
+#ifdef AOT
+    AotExecute(instructions);
+#else
+    if (VipActive)
+    {
+        VipExecuteFrame();
+    }
+    else if (JitActive)
+    {
+        JitExecute(instructions);
+    }
+    else if (ClosureActive)
+    {
+        ClosureExecute(instructions);
+    }
+    else
+    {
+        // Draws Hand Back Early, Carry On With The Rest Of The Budget (A Key Wait Uses It Up)
+        while (instructions > 0)
+        {
+            int executed;
+            RunChip8(instructions, &executed);
+            instructions -= executed;
+        }
+    }
+#endif
+}
+
+void StopTier()
+{
+    JitShutdown();
+    ClosureShutdown();
+}
@@ -0,0 +1,11 @@
+#ifndef RUNNER_H
+#define RUNNER_H
+
+#include <stdbool.h>
+
+// Shared By The Windowed Emulator & chip8-headless: Pick The Tier Once, Then Run Instructions On It
+void StartTier(bool vip, bool jit, bool jitVerify, bool closure);
+void RunInstructions(int instructions);
+void StopTier();
+
+#endif
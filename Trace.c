@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <SDL2/SDL.h>
+#include "Trace.h"
+
+#if TRACE_LEVEL > TRACE_LEVEL_NONE
+#include <stdatomic.h>
+
+// Ring Buffer Size (Power Of 2)
+#define TRACE_BUFFER_SIZE 8192
+
+// Trace Record, Formatted Later By The Logger Thread
+typedef struct
+{
+    const char *Format;
+    uint16_t A;
+    uint16_t B;
+} TraceRecord;
+
+// Single Producer (Emulation Thread), Single Consumer (Logger Thread) Ring Buffer
+TraceRecord TraceBuffer[TRACE_BUFFER_SIZE];
+atomic_uint TraceHead;
+atomic_uint TraceTail;
+atomic_bool TraceRunning;
+unsigned int TraceDropped = 0;
+SDL_Thread *TraceThread = NULL;
+
+void TracePush(const char *format, uint16_t a, uint16_t b)
+{
+    unsigned int head = atomic_load_explicit(&TraceHead, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&TraceTail, memory_order_acquire);
+
+    // Buffer Full, Drop Record Instead Of Blocking Emulation
+    if (head - tail == TRACE_BUFFER_SIZE)
+    {
+        TraceDropped++;
+        return;
+    }
+
+    TraceBuffer[head & (TRACE_BUFFER_SIZE - 1)] = (TraceRecord){format, a, b};
+    atomic_store_explicit(&TraceHead, head + 1, memory_order_release);
+}
+
+void TraceDrain()
+{
+    unsigned int tail = atomic_load_explicit(&TraceTail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&TraceHead, memory_order_acquire);
+
+    while (tail != head)
+    {
+        TraceRecord *record = &TraceBuffer[tail & (TRACE_BUFFER_SIZE - 1)];
+        printf(record->Format, record->A, record->B);
+        tail++;
+        atomic_store_explicit(&TraceTail, tail, memory_order_release);
+    }
+}
+
+int TraceLogger(void *data)
+{
+    while (atomic_load(&TraceRunning))
+    {
+        TraceDrain();
+        SDL_Delay(1);
+    }
+
+    // Flush Records Pushed Before Shutdown
+    TraceDrain();
+    return 0;
+}
+
+void TraceStart()
+{
+    atomic_store(&TraceHead, 0);
+    atomic_store(&TraceTail, 0);
+    atomic_store(&TraceRunning, true);
+    TraceThread = SDL_CreateThread(TraceLogger, "TraceLogger", NULL);
+}
+
+void TraceStop()
+{
+    atomic_store(&TraceRunning, false);
+    SDL_WaitThread(TraceThread, NULL);
+    TraceThread = NULL;
+
+    if (TraceDropped > 0)
+    {
+        printf("Trace: %u Records Dropped (Buffer Full)\n", TraceDropped);
+    }
+}
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+// Trace Levels (Selected At Compile Time With -DTRACE_LEVEL=N, 0 Removes All Tracing)
+#define TRACE_LEVEL_NONE 0
+#define TRACE_LEVEL_INPUT 1
+#define TRACE_LEVEL_OPCODES 2
+
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL TRACE_LEVEL_NONE
+#endif
+
+#if TRACE_LEVEL > TRACE_LEVEL_NONE
+void TracePush(const char *format, uint16_t a, uint16_t b);
+void TraceStart();
+void TraceStop();
+
+#define TRACE_START() TraceStart()
+#define TRACE_STOP() TraceStop()
+#else
+#define TRACE_START() ((void)0)
+#define TRACE_STOP() ((void)0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_INPUT
+#define TRACE_INPUT(format, key) TracePush(format, key, 0)
+#else
+#define TRACE_INPUT(format, key) ((void)0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_OPCODES
+#define TRACE_OPCODE(format, D) TracePush(format, (D)->Opcode, Chip8.PC)
+#else
+#define TRACE_OPCODE(format, D) ((void)0)
+#endif
+
+#endif
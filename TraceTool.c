@@ -0,0 +1,422 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ExecTrace.h"
+
+// Decoder For Binary Execution Traces Written With `CHIP8 -b <file>`
+
+typedef struct
+{
+    long FirstFrame;
+    long LastFrame;
+    int Register;
+    int PC;
+    bool Summary;
+    const char *File;
+
+} TRACE_OPTIONS;
+
+typedef struct
+{
+    uint64_t Frame;
+    uint64_t Cycle;
+    uint16_t PC;
+    uint16_t Opcode;
+    uint16_t I;
+    uint8_t SP;
+    uint16_t Written;
+    uint8_t V[16];
+
+} TRACE_STATE;
+
+TRACE_OPTIONS Options;
+FILE *Trace;
+uint64_t Remaining;
+
+// Opcode Class Names, Indexed By ClassifyOpcode
+const char *ClassNames[] = {
+    "00E0", "00EE", "0NNN", "1NNN", "2NNN", "3XNN", "4XNN", "5XY0", "6XNN", "7XNN",
+    "8XY0", "8XY1", "8XY2", "8XY3", "8XY4", "8XY5", "8XY6", "8XY7", "8XYE", "8XY?",
+    "9XY0", "ANNN", "BNNN", "CXNN", "DXYN", "EX9E", "EXA1", "EX??",
+    "FX07", "FX0A", "FX15", "FX18", "FX1E", "FX29", "FX33", "FX55", "FX65", "FX??"};
+
+#define CLASS_COUNT (sizeof(ClassNames) / sizeof(ClassNames[0]))
+
+// Fixed Class Names For Opcodes Identified By Top Nibble Alone
+const char *NibbleNames[16] = {
+    NULL, "1NNN", "2NNN", "3XNN", "4XNN", "5XY0", "6XNN", "7XNN",
+    NULL, "9XY0", "ANNN", "BNNN", "CXNN", "DXYN", NULL, NULL};
+
+int ClassifyOpcode(uint16_t opcode)
+{
+    char name[5];
+    const char *unknown;
+
+    switch (opcode >> 12)
+    {
+    case 0x0:
+        snprintf(name, sizeof(name), "%s", (opcode == 0x00E0) ? "00E0" : (opcode == 0x00EE) ? "00EE" : "0NNN");
+        unknown = "0NNN";
+        break;
+    case 0x8:
+        snprintf(name, sizeof(name), "8XY%X", opcode & 0xF);
+        unknown = "8XY?";
+        break;
+    case 0xE:
+        snprintf(name, sizeof(name), "EX%02X", opcode & 0xFF);
+        unknown = "EX??";
+        break;
+    case 0xF:
+        snprintf(name, sizeof(name), "FX%02X", opcode & 0xFF);
+        unknown = "FX??";
+        break;
+    default:
+        snprintf(name, sizeof(name), "%s", NibbleNames[opcode >> 12]);
+        unknown = NibbleNames[opcode >> 12];
+        break;
+    }
+
+    // Exact Class, Else The Group's Catch-All
+    for (unsigned int i = 0; i < CLASS_COUNT; i++)
+    {
+        if (strcmp(ClassNames[i], name) == 0)
+        {
+            return i;
+        }
+    }
+    for (unsigned int i = 0; i < CLASS_COUNT; i++)
+    {
+        if (strcmp(ClassNames[i], unknown) == 0)
+        {
+            return i;
+        }
+    }
+    return CLASS_COUNT - 1;
+}
+
+bool ReadByte(uint8_t *value)
+{
+    int c;
+    if (Remaining == 0 || (c = getc(Trace)) == EOF)
+    {
+        return false;
+    }
+    Remaining--;
+    *value = c;
+    return true;
+}
+
+bool ReadU16(uint16_t *value)
+{
+    uint8_t lo, hi;
+    if (!ReadByte(&lo) || !ReadByte(&hi))
+    {
+        return false;
+    }
+    *value = lo | (hi << 8);
+    return true;
+}
+
+// Returns 1 For An Instruction, 2 For A Frame Marker, 0 At End Of Trace
+int ReadRecord(TRACE_STATE *state)
+{
+    uint8_t flags, hi, lo;
+
+    if (!ReadByte(&flags))
+    {
+        return 0;
+    }
+
+    if (flags & EXEC_TRACE_FRAME)
+    {
+        state->Frame++;
+        return 2;
+    }
+
+    // PC (Predicted Sequential When Omitted)
+    if (flags & EXEC_TRACE_PC)
+    {
+        if (!ReadU16(&state->PC))
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        state->PC += 2;
+    }
+
+    if (!ReadByte(&hi) || !ReadByte(&lo))
+    {
+        return 0;
+    }
+    state->Opcode = (hi << 8) | lo;
+
+    if ((flags & EXEC_TRACE_I) && !ReadU16(&state->I))
+    {
+        return 0;
+    }
+    if ((flags & EXEC_TRACE_SP) && !ReadByte(&state->SP))
+    {
+        return 0;
+    }
+
+    // Register Writes
+    state->Written = 0;
+    if (flags & EXEC_TRACE_REG)
+    {
+        uint8_t index;
+        if (!ReadByte(&index) || !ReadByte(&state->V[index & 0xF]))
+        {
+            return 0;
+        }
+        state->Written = 1 << (index & 0xF);
+    }
+    if (flags & EXEC_TRACE_REGS)
+    {
+        if (!ReadU16(&state->Written))
+        {
+            return 0;
+        }
+        for (int i = 0; i < 16; i++)
+        {
+            if ((state->Written & (1 << i)) && !ReadByte(&state->V[i]))
+            {
+                return 0;
+            }
+        }
+    }
+
+    // Cycle Stamp
+    if (flags & EXEC_TRACE_CYCLE)
+    {
+        uint64_t delta = 0;
+        uint8_t byte;
+        int shift = 0;
+        do
+        {
+            if (!ReadByte(&byte))
+            {
+                return 0;
+            }
+            delta |= (uint64_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        state->Cycle += delta;
+    }
+    else
+    {
+        state->Cycle++;
+    }
+
+    return 1;
+}
+
+void PrintRecord(const TRACE_STATE *state)
+{
+    printf("%8llu %10llu %04x %04x I=%04x SP=%x", (unsigned long long)state->Frame, (unsigned long long)state->Cycle, state->PC, state->Opcode, state->I, state->SP);
+    for (int i = 0; i < 16; i++)
+    {
+        if (state->Written & (1 << i))
+        {
+            printf(" V%X=%02x", i, state->V[i]);
+        }
+    }
+    printf("\n");
+}
+
+bool ParseArguments(int argc, char **argv)
+{
+    Options.FirstFrame = 0;
+    Options.LastFrame = -1;
+    Options.Register = -1;
+    Options.PC = -1;
+    Options.Summary = false;
+    Options.File = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        // -f <first>-<last> - Frame Range (Inclusive)
+        if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+        {
+            if (sscanf(argv[++i], "%ld-%ld", &Options.FirstFrame, &Options.LastFrame) != 2)
+            {
+                return false;
+            }
+        }
+
+        // -r <n> - Only Instructions Writing Vn
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+        {
+            Options.Register = strtol(argv[++i], NULL, 16) & 0xF;
+        }
+
+        // -p <addr> - Only Instructions At PC (Hex)
+        else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+        {
+            Options.PC = strtol(argv[++i], NULL, 16) & 0xFFFF;
+        }
+
+        // -s - Summary Instead Of Listing
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            Options.Summary = true;
+        }
+
+        else if (argv[i][0] != '-' && Options.File == NULL)
+        {
+            Options.File = argv[i];
+        }
+
+        else
+        {
+            return false;
+        }
+    }
+    return Options.File != NULL;
+}
+
+int main(int argc, char **argv)
+{
+    if (!ParseArguments(argc, argv))
+    {
+        printf("Usage: %s [-f <first>-<last>] [-r <register>] [-p <pc>] [-s] <trace_file>\n", argv[0]);
+        return 1;
+    }
+
+    Trace = fopen(Options.File, "rb");
+    if (Trace == NULL)
+    {
+        printf("Couldn't Open Trace %s\n", Options.File);
+        return 1;
+    }
+
+    // Header
+    uint8_t header[EXEC_TRACE_HEADER_SIZE];
+    if (fread(header, 1, sizeof(header), Trace) != sizeof(header) || memcmp(header, EXEC_TRACE_MAGIC, 4) != 0)
+    {
+        printf("Not A CHIP-8 Execution Trace\n");
+        fclose(Trace);
+        return 1;
+    }
+    if ((header[4] | (header[5] << 8)) != EXEC_TRACE_VERSION)
+    {
+        printf("Unsupported Trace Version %d\n", header[4] | (header[5] << 8));
+        fclose(Trace);
+        return 1;
+    }
+    Remaining = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        Remaining |= (uint64_t)header[8 + i] << (8 * i);
+    }
+
+    // Unknown Length (A Windows Trace, Appended With fwrite, Whose Writer Never Closed It), Read To End Of File.
+    // Mapped Traces Store Their Length Every Frame, Since Their Unwritten Tail Is Zeros
+    if (Remaining == 0)
+    {
+        Remaining = UINT64_MAX;
+    }
+
+    TRACE_STATE state;
+    memset(&state, 0, sizeof(state));
+    state.PC = 0xFFFE;
+
+    uint64_t instructions = 0;
+    uint64_t matched = 0;
+    uint64_t classCounts[CLASS_COUNT] = {0};
+    uint64_t registerWrites[16] = {0};
+    uint64_t *pcCounts = calloc(0x10000, sizeof(uint64_t));
+
+    int kind;
+    while ((kind = ReadRecord(&state)) != 0)
+    {
+        if (kind != 1)
+        {
+            continue;
+        }
+        instructions++;
+
+        // Filters
+        if ((long)state.Frame < Options.FirstFrame || (Options.LastFrame >= 0 && (long)state.Frame > Options.LastFrame))
+        {
+            continue;
+        }
+        if (Options.Register >= 0 && !(state.Written & (1 << Options.Register)))
+        {
+            continue;
+        }
+        if (Options.PC >= 0 && state.PC != Options.PC)
+        {
+            continue;
+        }
+        matched++;
+
+        if (!Options.Summary)
+        {
+            PrintRecord(&state);
+            continue;
+        }
+
+        classCounts[ClassifyOpcode(state.Opcode)]++;
+        pcCounts[state.PC]++;
+        for (int i = 0; i < 16; i++)
+        {
+            if (state.Written & (1 << i))
+            {
+                registerWrites[i]++;
+            }
+        }
+    }
+    fclose(Trace);
+
+    if (Options.Summary)
+    {
+        printf("Frames: %llu\n", (unsigned long long)state.Frame);
+        printf("Instructions: %llu (%llu Matched)\n", (unsigned long long)instructions, (unsigned long long)matched);
+        printf("Cycles: %llu\n", (unsigned long long)state.Cycle);
+
+        printf("\nOpcodes:\n");
+        for (unsigned int i = 0; i < CLASS_COUNT; i++)
+        {
+            if (classCounts[i] > 0)
+            {
+                printf("  %s %12llu %6.2f%%\n", ClassNames[i], (unsigned long long)classCounts[i], 100.0 * classCounts[i] / matched);
+            }
+        }
+
+        printf("\nRegister Writes:\n");
+        for (int i = 0; i < 16; i++)
+        {
+            if (registerWrites[i] > 0)
+            {
+                printf("  V%X %12llu\n", i, (unsigned long long)registerWrites[i]);
+            }
+        }
+
+        // Ten Hottest Addresses
+        printf("\nHottest PCs:\n");
+        for (int n = 0; n < 10; n++)
+        {
+            int best = -1;
+            for (int pc = 0; pc < 0x10000; pc++)
+            {
+                if (pcCounts[pc] > 0 && (best < 0 || pcCounts[pc] > pcCounts[best]))
+                {
+                    best = pc;
+                }
+            }
+            if (best < 0)
+            {
+                break;
+            }
+            printf("  %04x %12llu\n", best, (unsigned long long)pcCounts[best]);
+            pcCounts[best] = 0;
+        }
+    }
+
+    free(pcCounts);
+    return 0;
+}
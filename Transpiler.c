@@ -0,0 +1,408 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "CHIP8.h"
+
+// Ahead-Of-Time ROM To C Translator
+//
+// Walks Every Statically Reachable Instruction From 0x200 And Emits One Labelled Block
+// Per Basic Block, With Direct gotos For Static Jumps, Calls & Skips. Returns, BNNN,
+// FX0A And Anything Outside The ROM Go Back Through A Switch On PC, And Blocks Whose
+// Bytes The ROM Overwrites Are Handed To The Interpreter, As Is Everything While An
+// Execution Trace Is Being Written.
+
+typedef struct
+{
+    OpcodeHandler Handler;
+    const char *Name;
+
+} HandlerEntry;
+
+const HandlerEntry HandlerNames[] = {
+    {Op_Unknown, "Op_Unknown"}, {Op_00E0, "Op_00E0"}, {Op_00EE, "Op_00EE"}, {Op_1NNN, "Op_1NNN"},
+    {Op_2NNN, "Op_2NNN"}, {Op_3XNN, "Op_3XNN"}, {Op_4XNN, "Op_4XNN"}, {Op_5XY0, "Op_5XY0"},
+    {Op_6XNN, "Op_6XNN"}, {Op_7XNN, "Op_7XNN"}, {Op_8XY0, "Op_8XY0"}, {Op_8XY1, "Op_8XY1"},
+    {Op_8XY2, "Op_8XY2"}, {Op_8XY3, "Op_8XY3"}, {Op_8XY4, "Op_8XY4"}, {Op_8XY5, "Op_8XY5"},
+    {Op_8XY6, "Op_8XY6"}, {Op_8XY7, "Op_8XY7"}, {Op_8XYE, "Op_8XYE"}, {Op_9XY0, "Op_9XY0"},
+    {Op_ANNN, "Op_ANNN"}, {Op_BNNN, "Op_BNNN"}, {Op_CXNN, "Op_CXNN"}, {Op_DXYN, "Op_DXYN"},
+    {Op_EX9E, "Op_EX9E"}, {Op_EXA1, "Op_EXA1"}, {Op_FX07, "Op_FX07"}, {Op_FX0A, "Op_FX0A"},
+    {Op_FX15, "Op_FX15"}, {Op_FX18, "Op_FX18"}, {Op_FX1E, "Op_FX1E"}, {Op_FX29, "Op_FX29"},
+    {Op_FX33, "Op_FX33"}, {Op_FX55, "Op_FX55"}, {Op_FX65, "Op_FX65"}};
+
+// Translated Address Range [MEMORY_STARTING_ADDRESS, CodeEnd)
+int CodeEnd;
+bool Reachable[MEMORY_SIZE];
+bool Leader[MEMORY_SIZE];
+DecodedInstruction Code[MEMORY_SIZE];
+FILE *Out;
+
+const char *HandlerName(OpcodeHandler H)
+{
+    for (unsigned int i = 0; i < sizeof(HandlerNames) / sizeof(HandlerNames[0]); i++)
+    {
+        if (HandlerNames[i].Handler == H)
+        {
+            return HandlerNames[i].Name;
+        }
+    }
+    return "Op_Unknown";
+}
+
+bool Translated(int address)
+{
+    return address >= MEMORY_STARTING_ADDRESS && address + 1 < CodeEnd;
+}
+
+bool IsSkip(OpcodeHandler H)
+{
+    return H == Op_3XNN || H == Op_4XNN || H == Op_5XY0 || H == Op_9XY0 || H == Op_EX9E || H == Op_EXA1;
+}
+
+// Instructions After Which Control Doesn't Simply Fall Through To The Next Instruction
+bool EndsBlock(OpcodeHandler H)
+{
+    return H == Op_1NNN || H == Op_2NNN || H == Op_00EE || H == Op_BNNN || H == Op_FX0A || IsSkip(H);
+}
+
+// Memory Writes End A Block So The Next One Re-Checks For Self-Modification
+bool WritesMemory(OpcodeHandler H)
+{
+    return H == Op_FX33 || H == Op_FX55;
+}
+
+void Walk()
+{
+    static int Worklist[MEMORY_SIZE * 2];
+    int count = 0;
+
+    Worklist[count++] = MEMORY_STARTING_ADDRESS;
+    Leader[MEMORY_STARTING_ADDRESS] = true;
+
+    while (count > 0)
+    {
+        int address = Worklist[--count];
+        if (!Translated(address) || Reachable[address])
+        {
+            continue;
+        }
+        Reachable[address] = true;
+
+        DecodedInstruction *D = &Code[address];
+        DecodeInstruction(address, D);
+        OpcodeHandler H = D->Handler;
+
+        int targets[2];
+        int targetCount = 0;
+        bool branch = true;
+
+        if (H == Op_1NNN)
+        {
+            targets[targetCount++] = D->NNN;
+        }
+        else if (H == Op_2NNN)
+        {
+            targets[targetCount++] = D->NNN;
+            targets[targetCount++] = address + 2;
+        }
+        else if (IsSkip(H))
+        {
+            targets[targetCount++] = address + 2;
+            targets[targetCount++] = address + 4;
+        }
+        else if (H == Op_00EE || H == Op_BNNN)
+        {
+            // Dynamic Target, Resolved Through The Dispatcher At Run Time
+        }
+        else
+        {
+            targets[targetCount++] = address + 2;
+            branch = (H == Op_FX0A || WritesMemory(H));
+        }
+
+        for (int i = 0; i < targetCount; i++)
+        {
+            if (Translated(targets[i]))
+            {
+                Leader[targets[i]] |= branch;
+                Worklist[count++] = targets[i];
+            }
+        }
+    }
+}
+
+// Transfer To A Static Target: Direct goto When Translated, Else Via The Dispatcher
+void EmitJump(int target)
+{
+    if (Translated(target) && Reachable[target])
+    {
+        fprintf(Out, "goto B_%03X;\n", target);
+    }
+    else
+    {
+        fprintf(Out, "{ Chip8.PC = 0x%03X; goto Dispatch; }\n", target & 0xFFFF);
+    }
+}
+
+// `after` Is How Many Instructions Follow In The Block, Whose Cycles Were Already Added On Entry
+void EmitInstruction(int address, int after, const DecodedInstruction *D)
+{
+    OpcodeHandler H = D->Handler;
+    int X = D->X;
+    int Y = D->Y;
+
+    fprintf(Out, "    // %03X: %04X\n", address, D->Opcode);
+
+    if (H == Op_Unknown)
+    {
+    }
+    else if (H == Op_6XNN)
+    {
+        fprintf(Out, "    Chip8.V[%d] = %d;\n", X, D->NN);
+    }
+    else if (H == Op_7XNN)
+    {
+        fprintf(Out, "    Chip8.V[%d] = (Chip8.V[%d] + %d) & 0xFF;\n", X, X, D->NN);
+    }
+    else if (H == Op_8XY0)
+    {
+        fprintf(Out, "    Chip8.V[%d] = Chip8.V[%d];\n", X, Y);
+    }
+    else if (H == Op_8XY1 || H == Op_8XY2 || H == Op_8XY3)
+    {
+        char op = (H == Op_8XY1) ? '|' : (H == Op_8XY2) ? '&' : '^';
+        fprintf(Out, "    Chip8.V[%d] = Chip8.V[%d] %c Chip8.V[%d];\n", X, X, op, Y);
+    }
+    else if (H == Op_ANNN)
+    {
+        fprintf(Out, "    Chip8.I = 0x%03X;\n", D->NNN);
+    }
+    else if (H == Op_FX1E)
+    {
+        fprintf(Out, "    Chip8.I += Chip8.V[%d];\n", X);
+    }
+    else if (H == Op_FX29)
+    {
+        fprintf(Out, "    Chip8.I = Chip8.V[%d] * 5;\n", X);
+    }
+    else if (H == Op_FX07)
+    {
+        fprintf(Out, "    Chip8.V[%d] = ReadTimer(&Chip8.Delay_Timer, Chip8.Cycles - %d);\n", X, after);
+    }
+    else if (H == Op_FX15)
+    {
+        fprintf(Out, "    WriteTimer(&Chip8.Delay_Timer, Chip8.V[%d], Chip8.Cycles - %d);\n", X, after);
+    }
+    else if (H == Op_FX18)
+    {
+        fprintf(Out, "    WriteTimer(&Chip8.Sound_Timer, Chip8.V[%d], Chip8.Cycles - %d);\n", X, after);
+    }
+    else if (H == Op_1NNN)
+    {
+        fprintf(Out, "    ");
+        EmitJump(D->NNN);
+    }
+    else if (H == Op_2NNN)
+    {
+        fprintf(Out, "    Chip8.Stack[STACK_INDEX(Chip8.SP)] = 0x%03X;\n", address + 2);
+        fprintf(Out, "    Chip8.SP++;\n    ");
+        EmitJump(D->NNN);
+    }
+    else if (H == Op_BNNN)
+    {
+        fprintf(Out, "    Chip8.PC = Chip8.V[0] + 0x%03X;\n    goto Dispatch;\n", D->NNN);
+    }
+    else if (H == Op_00EE || H == Op_FX0A)
+    {
+        // Handler Works Relative To PC (Return), Or May Halt Until A Key Is Down
+        fprintf(Out, "    Chip8.PC = 0x%03X;\n", address + 2);
+        fprintf(Out, "    %s(&D_%03X);\n    goto Dispatch;\n", HandlerName(H), address);
+    }
+    else if (IsSkip(H))
+    {
+        if (H == Op_3XNN || H == Op_4XNN)
+        {
+            fprintf(Out, "    if (Chip8.V[%d] %s %d)\n", X, (H == Op_3XNN) ? "==" : "!=", D->NN);
+        }
+        else if (H == Op_5XY0 || H == Op_9XY0)
+        {
+            fprintf(Out, "    if (Chip8.V[%d] %s Chip8.V[%d])\n", X, (H == Op_5XY0) ? "==" : "!=", Y);
+        }
+        else
+        {
+            fprintf(Out, "    if (Chip8.Key[Chip8.V[%d] & 0xF] %s 0)\n", X, (H == Op_EX9E) ? "!=" : "==");
+        }
+        fprintf(Out, "        ");
+        EmitJump(address + 4);
+        fprintf(Out, "    ");
+        EmitJump(address + 2);
+    }
+    else
+    {
+        // Everything Else Runs The Interpreter's Handler With A Pre-Decoded Operand Block
+        fprintf(Out, "    %s(&D_%03X);\n", HandlerName(H), address);
+    }
+}
+
+bool NeedsDecoded(OpcodeHandler H)
+{
+    return H == Op_00E0 || H == Op_00EE || H == Op_8XY4 || H == Op_8XY5 || H == Op_8XY6 || H == Op_8XY7 ||
+           H == Op_8XYE || H == Op_CXNN || H == Op_DXYN || H == Op_FX0A || H == Op_FX33 || H == Op_FX55 || H == Op_FX65;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        printf("Usage: %s <rom.ch8> <output.c>\n", argv[0]);
+        return 1;
+    }
+
+    InitializeChip8();
+    InitializeOpcodeTables();
+    if (LoadROM(argv[1]) != 0)
+    {
+        return 1;
+    }
+
+    FILE *ROM = fopen(argv[1], "rb");
+    fseek(ROM, 0, SEEK_END);
+    int ROMSize = ftell(ROM);
+    fclose(ROM);
+    CodeEnd = MEMORY_STARTING_ADDRESS + ROMSize;
+
+    Walk();
+
+    // Collect Blocks: Each Runs From A Leader To Its Terminator Or The Next Leader
+    static int BlockStart[MEMORY_SIZE];
+    static int BlockEnd[MEMORY_SIZE];
+    static int BlockLength[MEMORY_SIZE];
+    int blocks = 0;
+    for (int address = MEMORY_STARTING_ADDRESS; address < CodeEnd; address++)
+    {
+        if (!Reachable[address] || !Leader[address])
+        {
+            continue;
+        }
+
+        int at = address;
+        int length = 0;
+        do
+        {
+            OpcodeHandler H = Code[at].Handler;
+            at += 2;
+            length++;
+            if (EndsBlock(H) || WritesMemory(H))
+            {
+                break;
+            }
+        } while (Reachable[at] && !Leader[at]);
+
+        BlockStart[blocks] = address;
+        BlockEnd[blocks] = at;
+        BlockLength[blocks] = length;
+        blocks++;
+    }
+
+    Out = fopen(argv[2], "w");
+    if (Out == NULL)
+    {
+        printf("Couldn't Create %s\n", argv[2]);
+        return 1;
+    }
+
+    // Header & ROM Image
+    fprintf(Out, "// Generated By chip8-aot From %s, Do Not Edit\n\n", argv[1]);
+    fprintf(Out, "#include <stdio.h>\n#include <stdbool.h>\n#include <string.h>\n#include \"CHIP8.h\"\n#include \"ExecTrace.h\"\n#include \"Aot.h\"\n\n");
+    fprintf(Out, "const char *AotROMName = \"%s\";\n\n", argv[1]);
+    fprintf(Out, "static const uint8_t ROM[%d] = {", ROMSize);
+    for (int i = 0; i < ROMSize; i++)
+    {
+        fprintf(Out, "%s0x%02X,", (i % 16 == 0) ? "\n    " : " ", Chip8.Memory[MEMORY_STARTING_ADDRESS + i]);
+    }
+    fprintf(Out, "\n};\n\n");
+
+    // Block Table For Self-Modification Checks
+    fprintf(Out, "#define BLOCK_COUNT %d\n\n", blocks);
+    fprintf(Out, "static const uint16_t BlockStart[BLOCK_COUNT] = {");
+    for (int b = 0; b < blocks; b++)
+    {
+        fprintf(Out, "%s0x%03X,", (b % 12 == 0) ? "\n    " : " ", BlockStart[b]);
+    }
+    fprintf(Out, "\n};\n\nstatic const uint16_t BlockEnd[BLOCK_COUNT] = {");
+    for (int b = 0; b < blocks; b++)
+    {
+        fprintf(Out, "%s0x%03X,", (b % 12 == 0) ? "\n    " : " ", BlockEnd[b]);
+    }
+    fprintf(Out, "\n};\n\nstatic bool Stale[BLOCK_COUNT];\n\n");
+
+    // Operand Blocks For Instructions Run Through Interpreter Handlers
+    for (int address = MEMORY_STARTING_ADDRESS; address < CodeEnd; address++)
+    {
+        const DecodedInstruction *D = &Code[address];
+        if (Reachable[address] && NeedsDecoded(D->Handler))
+        {
+            fprintf(Out, "static DecodedInstruction D_%03X = {%s, 0x%04X, 0x%03X, %d, %d, %d, %d};\n",
+                    address, HandlerName(D->Handler), D->Opcode, D->NNN, D->X, D->Y, D->N, D->NN);
+        }
+    }
+
+    // Self-Modification Hook: Any Block Whose Bytes No Longer Match The ROM Goes Stale
+    fprintf(Out, "\nstatic void MemoryWritten(int address, int length)\n{\n");
+    fprintf(Out, "    for (int i = address; i < address + length; i++)\n    {\n");
+    fprintf(Out, "        if (i < %d || i >= %d || Chip8.Memory[i] == ROM[i - %d])\n        {\n            continue;\n        }\n",
+            MEMORY_STARTING_ADDRESS, CodeEnd, MEMORY_STARTING_ADDRESS);
+    fprintf(Out, "        for (int b = 0; b < BLOCK_COUNT; b++)\n        {\n");
+    fprintf(Out, "            if (i >= BlockStart[b] && i < BlockEnd[b])\n            {\n                Stale[b] = true;\n            }\n        }\n");
+    fprintf(Out, "    }\n}\n\n");
+
+    fprintf(Out, "void AotInitialize()\n{\n");
+    fprintf(Out, "    MemoryWriteHook = MemoryWritten;\n");
+    fprintf(Out, "    memcpy(&Chip8.Memory[%d], ROM, sizeof(ROM));\n", MEMORY_STARTING_ADDRESS);
+    fprintf(Out, "    InvalidateDecoded(%d, sizeof(ROM));\n}\n\n", MEMORY_STARTING_ADDRESS);
+
+    // Execution: Dispatcher, Interpreter Fallback, Then One Label Per Block
+    fprintf(Out, "void AotExecute(int instructions)\n{\n");
+    fprintf(Out, "Dispatch:\n    if (instructions <= 0)\n    {\n        return;\n    }\n");
+    fprintf(Out, "    if (WaitingForKey())\n    {\n        Chip8.Cycles += instructions;\n        return;\n    }\n");
+
+    // An Execution Trace Records Every Instruction, Which Only The Interpreter Does
+    fprintf(Out, "    if (ExecTraceActive)\n    {\n        goto Interpret;\n    }\n");
+    fprintf(Out, "    switch (Chip8.PC)\n    {\n");
+    for (int b = 0; b < blocks; b++)
+    {
+        fprintf(Out, "    case 0x%03X:\n        goto B_%03X;\n", BlockStart[b], BlockStart[b]);
+    }
+    fprintf(Out, "    default:\n        goto Interpret;\n    }\n\n");
+    fprintf(Out, "Interpret:\n    if (instructions <= 0)\n    {\n        return;\n    }\n");
+    fprintf(Out, "    ExecuteInstructions();\n    instructions--;\n    goto Dispatch;\n");
+
+    for (int b = 0; b < blocks; b++)
+    {
+        int start = BlockStart[b];
+        fprintf(Out, "\nB_%03X:\n", start);
+        fprintf(Out, "    if (instructions < %d || Stale[%d])\n    {\n        Chip8.PC = 0x%03X;\n        goto Interpret;\n    }\n",
+                BlockLength[b], b, start);
+        fprintf(Out, "    instructions -= %d;\n    Chip8.Cycles += %d;\n", BlockLength[b], BlockLength[b]);
+
+        int at = start;
+        for (int n = 0; n < BlockLength[b]; n++, at += 2)
+        {
+            EmitInstruction(at, BlockLength[b] - 1 - n, &Code[at]);
+        }
+
+        // Fell Off The End Without A Transfer, Continue At The Next Block
+        OpcodeHandler last = Code[at - 2].Handler;
+        if (!EndsBlock(last))
+        {
+            fprintf(Out, "    ");
+            EmitJump(at);
+        }
+    }
+    fprintf(Out, "}\n");
+    fclose(Out);
+
+    printf("Translated %d Blocks To %s\n", blocks, argv[2]);
+    return 0;
+}
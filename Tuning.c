@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "CHIP8.h"
+#include "Tuning.h"
+
+bool TuningActive = false;
+
+static uint64_t ProgramHash;
+static bool Cached = false;
+static bool Saved = false;
+
+// Whether The Program Has A Delay Timer Poll To Wait In, Found Once At The Start
+static bool TimerPaced = false;
+
+// Current Window
+static int ActiveFrames = 0;
+static int IdleFrames = 0;
+static uint64_t WindowDraws = 0;
+static uint64_t LastDraws = 0;
+static int StableWindows = 0;
+
+// Highest IPF Seen Running Out Of Budget, Lowering Never Goes Back Down To It
+static int TooSlow = 0;
+
+static void CachePath(char *path, size_t size)
+{
+    const char *home = getenv("HOME");
+    if (home != NULL)
+    {
+        snprintf(path, size, "%s/%s", home, TUNING_CACHE_FILE);
+    }
+    else
+    {
+        snprintf(path, size, "%s", TUNING_CACHE_FILE);
+    }
+}
+
+// Read From Memory Rather Than The Decoded Image, Which Idle Loop Marks Aren't Kept In For Every Tier
+static uint16_t OpcodeAt(int address)
+{
+    return (Chip8.Memory[address] << 8) | Chip8.Memory[address + 1];
+}
+
+// Delay Timer Poll: FX07, 3XNN, 1NNN Back To The FX07
+static bool IsPollLoop(int address)
+{
+    if (address < 0 || address + 6 > MEMORY_SIZE)
+    {
+        return false;
+    }
+
+    uint16_t get = OpcodeAt(address);
+    uint16_t skip = OpcodeAt(address + 2);
+    return (get & 0xF0FF) == 0xF007 && (skip & 0xFF00) == (0x3000 | (get & 0x0F00)) &&
+           OpcodeAt(address + 4) == (0x1000 | address);
+}
+
+// The Frame Ended Waiting On The Delay Timer (As Its Last Instruction Saw It), Work Done With Budget To Spare
+static bool FrameIdled()
+{
+    for (int back = 0; back <= 4; back += 2)
+    {
+        int address = Chip8.PC - back;
+        if (IsPollLoop(address))
+        {
+            return ReadTimer(&Chip8.Delay_Timer, Chip8.Cycles) != (OpcodeAt(address + 2) & 0xFF);
+        }
+    }
+    return false;
+}
+
+static int Step(int instructionsPerFrame, int divisor)
+{
+    int step = instructionsPerFrame / divisor;
+    return (step > 0) ? step : 1;
+}
+
+// Next IPF From The Window Just Measured
+static int Decide(int instructionsPerFrame)
+{
+    int next = instructionsPerFrame;
+    int idlePercent = IdleFrames * 100 / ActiveFrames;
+
+    if (TimerPaced)
+    {
+        // Waiting At The End Of Nearly Every Frame: The Same Speed Costs Fewer Instructions
+        if (idlePercent >= TUNING_IDLE_PERCENT)
+        {
+            next -= Step(instructionsPerFrame, 8);
+        }
+
+        // Frames Keep Running Out Before The Game Gets Back To Its Wait: It Runs Slow
+        else if (idlePercent < TUNING_BUSY_PERCENT)
+        {
+            TooSlow = instructionsPerFrame;
+            next += Step(instructionsPerFrame, 4);
+        }
+    }
+
+    // Paced By The CPU Alone: Drawing Far More Than A Frame Can Show Means The Budget Outruns It
+    else if (WindowDraws > (uint64_t)TUNING_DRAWS_PER_TICK * ActiveFrames)
+    {
+        next -= Step(instructionsPerFrame, 8);
+    }
+
+    if (next < instructionsPerFrame && next <= TooSlow)
+    {
+        next = TooSlow + 1;
+    }
+    if (next < TUNING_MIN_IPF)
+    {
+        next = TUNING_MIN_IPF;
+    }
+    if (next > TUNING_MAX_IPF)
+    {
+        next = TUNING_MAX_IPF;
+    }
+    return next;
+}
+
+static void Save(int instructionsPerFrame)
+{
+    char path[1024];
+    CachePath(path, sizeof(path));
+
+    FILE *file = fopen(path, "a");
+    if (file == NULL)
+    {
+        printf("Auto IPF: Couldn't Write %s\n", path);
+        return;
+    }
+    fprintf(file, "%016llx %d\n", (unsigned long long)ProgramHash, instructionsPerFrame);
+    fclose(file);
+    Saved = true;
+}
+
+// After The ROM Is Loaded: The Cached IPF For This Program, Or The One Given While Tuning Starts From It
+int TuningStart(int instructionsPerFrame)
+{
+    ProgramHash = HashBytes(HASH_OFFSET_BASIS, Chip8.Memory + MEMORY_STARTING_ADDRESS,
+                            MEMORY_SIZE - MEMORY_STARTING_ADDRESS);
+
+    char path[1024];
+    CachePath(path, sizeof(path));
+
+    FILE *file = fopen(path, "r");
+    if (file != NULL)
+    {
+        unsigned long long hash;
+        int value;
+        while (fscanf(file, "%llx %d", &hash, &value) == 2)
+        {
+            if (hash == ProgramHash && value >= TUNING_MIN_IPF && value <= TUNING_MAX_IPF)
+            {
+                instructionsPerFrame = value;
+                Cached = true;
+            }
+        }
+        fclose(file);
+    }
+
+    for (int i = MEMORY_STARTING_ADDRESS; i < MEMORY_SIZE; i += 2)
+    {
+        TimerPaced = TimerPaced || IsPollLoop(i);
+    }
+
+    LastDraws = SpritesDrawn;
+    TuningActive = !Cached;
+    return instructionsPerFrame;
+}
+
+// Called After Each Whole Frame, Returns The IPF For The Next. Key Waits & Jump-To-Self Halts Say
+// Nothing About Speed, So Those Frames Are Left Out
+int TuningFrame(int instructionsPerFrame)
+{
+    uint64_t draws = SpritesDrawn - LastDraws;
+    LastDraws = SpritesDrawn;
+
+    bool halted = Chip8.PC < MEMORY_SIZE - 1 && OpcodeAt(Chip8.PC) == (0x1000 | Chip8.PC);
+    if (Chip8.Halted || halted)
+    {
+        return instructionsPerFrame;
+    }
+
+    ActiveFrames++;
+    WindowDraws += draws;
+    if (FrameIdled())
+    {
+        IdleFrames++;
+    }
+    if (ActiveFrames < TUNING_WINDOW)
+    {
+        return instructionsPerFrame;
+    }
+
+    int next = Decide(instructionsPerFrame);
+    ActiveFrames = 0;
+    IdleFrames = 0;
+    WindowDraws = 0;
+
+    // Settled: Remember It For Next Time & Stop Measuring
+    StableWindows = (next == instructionsPerFrame) ? StableWindows + 1 : 0;
+    if (StableWindows == TUNING_SETTLE_WINDOWS)
+    {
+        Save(next);
+        TuningActive = false;
+    }
+    return next;
+}
+
+void TuningReport(int instructionsPerFrame)
+{
+    printf("Auto IPF: %d Instructions Per Frame (%s, Program %016llx)\n", instructionsPerFrame,
+           Cached ? "Cached" : Saved ? "Tuned & Saved" : "Still Tuning", (unsigned long long)ProgramHash);
+}
@@ -0,0 +1,32 @@
+#ifndef TUNING_H
+#define TUNING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Instructions Per Frame The Tuner Stays Within
+#define TUNING_MIN_IPF 4
+#define TUNING_MAX_IPF 128
+
+// Frames Per Decision (Key Waits Don't Count), & Unchanged Decisions Before The Result Is Cached
+#define TUNING_WINDOW 60
+#define TUNING_SETTLE_WINDOWS 3
+
+// A Timer-Paced ROM Idling At The End Of At Least This Many Percent Of Its Frames Has Budget To Spare,
+// Fewer Than TUNING_BUSY_PERCENT & It's Running Out Of Budget Mid-Frame
+#define TUNING_IDLE_PERCENT 90
+#define TUNING_BUSY_PERCENT 50
+
+// A ROM That Never Polls The Delay Timer Drawing More Than This Per Tick Is Outrunning The Display
+#define TUNING_DRAWS_PER_TICK 8
+
+// Per-ROM Cache File (Text, One "<Program Hash> <IPF>" Line Per ROM, Last One Wins), In $HOME
+#define TUNING_CACHE_FILE ".retro8_ipf"
+
+extern bool TuningActive;
+
+int TuningStart(int instructionsPerFrame);
+int TuningFrame(int instructionsPerFrame);
+void TuningReport(int instructionsPerFrame);
+
+#endif
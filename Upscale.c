@@ -0,0 +1,306 @@
+#include <string.h>
+#include "CHIP8.h"
+#include "Expand.h"
+#include "Upscale.h"
+
+// The Filters Work On Whole Packed Words: Each Rule Of Scale2x / Scale3x (EPX) Is A Few Bitwise Operations Deciding
+// 64 Pixels At Once, Which For A 1-Bit Display Is All A Compare & Select Per Pixel Comes Down To
+
+static void Scale2x(const uint64_t *in, int words, int height, uint64_t *out);
+static void Scale3x(const uint64_t *in, int words, int height, uint64_t *out);
+static void Average(const uint64_t *in, int words, int height, uint8_t *shades);
+
+// Intermediate Images, Twice & Three Times The Display (Then Six Times For Smoothing)
+static uint64_t Twice[GRID_HEIGHT * 2 * 2];
+static uint64_t Thrice[GRID_HEIGHT * 3 * 3];
+static uint64_t Sixfold[GRID_HEIGHT * 6 * 6];
+
+static void RunScale2x(const uint64_t *display, UPSCALE_IMAGE *image)
+{
+    Scale2x(display, 1, GRID_HEIGHT, image->Bits);
+}
+
+static void RunScale3x(const uint64_t *display, UPSCALE_IMAGE *image)
+{
+    Scale3x(display, 1, GRID_HEIGHT, image->Bits);
+}
+
+// Scale4x Is Scale2x Run Twice
+static void RunScale4x(const uint64_t *display, UPSCALE_IMAGE *image)
+{
+    Scale2x(display, 1, GRID_HEIGHT, Twice);
+    Scale2x(Twice, 2, GRID_HEIGHT * 2, image->Bits);
+}
+
+// Scale3x Then Scale2x, Averaged Back Down Over 2x2 Blocks: 3x With The Corners EPX Cuts Half Lit
+static void RunSmooth(const uint64_t *display, UPSCALE_IMAGE *image)
+{
+    Scale3x(display, 1, GRID_HEIGHT, Thrice);
+    Scale2x(Thrice, 3, GRID_HEIGHT * 3, Sixfold);
+    Average(Sixfold, 6, GRID_HEIGHT * 6, image->Shades);
+}
+
+static const UPSCALE_FILTER Upscalers[] = {
+    {"scale2x", 2, false, RunScale2x},
+    {"scale3x", 3, false, RunScale3x},
+    {"scale4x", 4, false, RunScale4x},
+    {"smooth", 3, true, RunSmooth},
+};
+
+const UPSCALE_FILTER *Upscaler = NULL;
+
+bool SelectUpscaler(const char *name)
+{
+    for (int i = 0; i < (int)(sizeof(Upscalers) / sizeof(Upscalers[0])); i++)
+    {
+        if (strcmp(Upscalers[i].Name, name) == 0)
+        {
+            Upscaler = &Upscalers[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Neighbours Of Every Pixel In Word w Of A Row, The Edges Standing In For What's Past Them
+static uint64_t LeftOf(const uint64_t *row, int w)
+{
+    uint64_t carry = (w > 0) ? row[w - 1] & 1 : row[w] >> 63;
+    return (row[w] >> 1) | (carry << 63);
+}
+
+static uint64_t RightOf(const uint64_t *row, int w, int words)
+{
+    uint64_t carry = (w < words - 1) ? row[w + 1] >> 63 : row[w] & 1;
+    return (row[w] << 1) | carry;
+}
+
+// Pixels From lit Where mask Is Set, From fallback Elsewhere
+static uint64_t Pick(uint64_t mask, uint64_t lit, uint64_t fallback)
+{
+    return (mask & lit) | (~mask & fallback);
+}
+
+// Each Bit Of x Moved To Twice Its Position (32 Bits Into 64)
+static uint64_t Spread2(uint64_t x)
+{
+    x &= 0xFFFFFFFF;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+}
+
+// Each Bit Of x Moved To Three Times Its Position (8 Bits Into 24)
+static uint32_t Spread3(uint32_t x)
+{
+    x = (x | (x << 8)) & 0x00F00F;
+    x = (x | (x << 4)) & 0x0C30C3;
+    x = (x | (x << 2)) & 0x249249;
+    return x;
+}
+
+// One Output Row Of Pixels Taken In Turn From left & right: 2 Words
+static void Interleave2(uint64_t left, uint64_t right, uint64_t *out)
+{
+    out[0] = (Spread2(left >> 32) << 1) | Spread2(right >> 32);
+    out[1] = (Spread2(left) << 1) | Spread2(right);
+}
+
+// The Same From Three: 3 Words, Built 8 Pixels (24 Bits Out) At A Time
+static void Interleave3(uint64_t left, uint64_t middle, uint64_t right, uint64_t *out)
+{
+    uint8_t bytes[24];
+    for (int b = 0; b < 8; b++)
+    {
+        int shift = 56 - 8 * b;
+        uint32_t chunk = (Spread3((left >> shift) & 0xFF) << 2) | (Spread3((middle >> shift) & 0xFF) << 1) |
+                         Spread3((right >> shift) & 0xFF);
+        bytes[3 * b] = (uint8_t)(chunk >> 16);
+        bytes[3 * b + 1] = (uint8_t)(chunk >> 8);
+        bytes[3 * b + 2] = (uint8_t)chunk;
+    }
+    for (int w = 0; w < 3; w++)
+    {
+        out[w] = 0;
+        for (int b = 0; b < 8; b++)
+        {
+            out[w] = (out[w] << 8) | bytes[8 * w + b];
+        }
+    }
+}
+
+// The 3x3 Neighbourhood Of Word w In Row y (Rows Past The Top & Bottom Repeat The Edge), Named As In Scale3x:
+//
+//   A B C
+//   D E F
+//   G H I
+typedef struct
+{
+    uint64_t A, B, C, D, E, F, G, H, I;
+
+    // Where An Edge Runs Diagonally Past A Corner Of E: Top Left, Top Right, Bottom Left, Bottom Right
+    uint64_t TopLeft, TopRight, BottomLeft, BottomRight;
+
+} NEIGHBOURHOOD;
+
+static void Neighbourhood(const uint64_t *in, int words, int height, int y, int w, NEIGHBOURHOOD *n)
+{
+    const uint64_t *up = in + ((y > 0) ? y - 1 : y) * words;
+    const uint64_t *row = in + y * words;
+    const uint64_t *down = in + ((y < height - 1) ? y + 1 : y) * words;
+
+    n->A = LeftOf(up, w);
+    n->B = up[w];
+    n->C = RightOf(up, w, words);
+    n->D = LeftOf(row, w);
+    n->E = row[w];
+    n->F = RightOf(row, w, words);
+    n->G = LeftOf(down, w);
+    n->H = down[w];
+    n->I = RightOf(down, w, words);
+
+    n->TopLeft = ~(n->D ^ n->B) & (n->B ^ n->F) & (n->D ^ n->H);
+    n->TopRight = ~(n->B ^ n->F) & (n->B ^ n->D) & (n->F ^ n->H);
+    n->BottomLeft = ~(n->D ^ n->H) & (n->D ^ n->B) & (n->H ^ n->F);
+    n->BottomRight = ~(n->H ^ n->F) & (n->D ^ n->H) & (n->B ^ n->F);
+}
+
+// Scale2x (EPX): Each Pixel Becomes 2x2, A Quarter Taking Its Neighbours' Colour Where They Agree Across That Corner
+static void Scale2x(const uint64_t *in, int words, int height, uint64_t *out)
+{
+    for (int y = 0; y < height; y++)
+    {
+        uint64_t *top = out + 2 * y * 2 * words;
+        uint64_t *bottom = top + 2 * words;
+
+        for (int w = 0; w < words; w++)
+        {
+            NEIGHBOURHOOD n;
+            Neighbourhood(in, words, height, y, w, &n);
+
+            Interleave2(Pick(n.TopLeft, n.B, n.E), Pick(n.TopRight, n.F, n.E), top + 2 * w);
+            Interleave2(Pick(n.BottomLeft, n.D, n.E), Pick(n.BottomRight, n.H, n.E), bottom + 2 * w);
+        }
+    }
+}
+
+// Scale3x: Each Pixel Becomes 3x3, Corners As In Scale2x & Edges Only Where The Corner Beyond Them Differs
+static void Scale3x(const uint64_t *in, int words, int height, uint64_t *out)
+{
+    for (int y = 0; y < height; y++)
+    {
+        uint64_t *top = out + 3 * y * 3 * words;
+        uint64_t *middle = top + 3 * words;
+        uint64_t *bottom = middle + 3 * words;
+
+        for (int w = 0; w < words; w++)
+        {
+            NEIGHBOURHOOD n;
+            Neighbourhood(in, words, height, y, w, &n);
+
+            uint64_t up = (n.TopLeft & (n.E ^ n.C)) | (n.TopRight & (n.E ^ n.A));
+            uint64_t left = (n.TopLeft & (n.E ^ n.G)) | (n.BottomLeft & (n.E ^ n.A));
+            uint64_t right = (n.TopRight & (n.E ^ n.I)) | (n.BottomRight & (n.E ^ n.C));
+            uint64_t down = (n.BottomLeft & (n.E ^ n.I)) | (n.BottomRight & (n.E ^ n.G));
+
+            Interleave3(Pick(n.TopLeft, n.D, n.E), Pick(up, n.B, n.E), Pick(n.TopRight, n.F, n.E), top + 3 * w);
+            Interleave3(Pick(left, n.D, n.E), n.E, Pick(right, n.F, n.E), middle + 3 * w);
+            Interleave3(Pick(n.BottomLeft, n.D, n.E), Pick(down, n.H, n.E), Pick(n.BottomRight, n.F, n.E),
+                        bottom + 3 * w);
+        }
+    }
+}
+
+// Lit Pixels In Each 2x2 Block, 0 To 4: Pairs Are Counted Across The Word, Then Two Rows Of Pairs Added
+// Into 4-Bit Fields (Even & Odd Pairs Apart, So Neither Sum Runs Into The Next)
+static void Average(const uint64_t *in, int words, int height, uint8_t *shades)
+{
+    const uint64_t ones = 0x5555555555555555ULL;
+    const uint64_t twos = 0x3333333333333333ULL;
+
+    for (int y = 0; y < height / 2; y++)
+    {
+        const uint64_t *upper = in + 2 * y * words;
+        const uint64_t *lower = upper + words;
+
+        for (int w = 0; w < words; w++)
+        {
+            uint64_t top = (upper[w] & ones) + ((upper[w] >> 1) & ones);
+            uint64_t bottom = (lower[w] & ones) + ((lower[w] >> 1) & ones);
+            uint64_t even = (top & twos) + (bottom & twos);
+            uint64_t odd = ((top >> 2) & twos) + ((bottom >> 2) & twos);
+
+            // Pair k Counts From The Right, Pixel x From The Left
+            uint8_t *out = shades + (y * words + w) * 32;
+            for (int x = 0; x < 32; x++)
+            {
+                int k = 31 - x;
+                out[x] = (uint8_t)(((k & 1) ? odd >> (2 * (k - 1)) : even >> (2 * k)) & 0xF);
+            }
+        }
+    }
+}
+
+void UpscaleDisplay(const uint64_t *display, UPSCALE_IMAGE *image)
+{
+    int factor = (Upscaler != NULL) ? Upscaler->Factor : 1;
+    image->Width = GRID_WIDTH * factor;
+    image->Height = GRID_HEIGHT * factor;
+    image->Words = image->Width / 64;
+    image->Shaded = Upscaler != NULL && Upscaler->Shaded;
+
+    if (Upscaler == NULL)
+    {
+        memcpy(image->Bits, display, GRID_HEIGHT * sizeof(uint64_t));
+        return;
+    }
+    Upscaler->Run(display, image);
+}
+
+// A Shade's Colour: Each 8-Bit Channel Of off Moved shade Steps Of UPSCALE_SHADES - 1 Towards on
+static uint32_t Blend(uint32_t on, uint32_t off, int shade)
+{
+    const int steps = UPSCALE_SHADES - 1;
+    uint32_t colour = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        uint32_t channel = (((off >> shift) & 0xFF) * (steps - shade) + ((on >> shift) & 0xFF) * shade + steps / 2) / steps;
+        colour |= channel << shift;
+    }
+    return colour;
+}
+
+void UpscaleExpand8(const UPSCALE_IMAGE *image, int scale, uint8_t on, uint8_t off, void *dest, int pitch)
+{
+    if (!image->Shaded)
+    {
+        ExpandRows8(image->Bits, image->Words, 0, image->Height - 1, scale, on, off, dest, pitch);
+        return;
+    }
+
+    uint8_t palette[UPSCALE_SHADES];
+    for (int shade = 0; shade < UPSCALE_SHADES; shade++)
+    {
+        palette[shade] = (uint8_t)Blend(on, off, shade);
+    }
+    ExpandShades8(image->Shades, image->Width, 0, image->Height - 1, scale, palette, dest, pitch);
+}
+
+void UpscaleExpand32(const UPSCALE_IMAGE *image, int scale, uint32_t on, uint32_t off, void *dest, int pitch)
+{
+    if (!image->Shaded)
+    {
+        ExpandRows32(image->Bits, image->Words, 0, image->Height - 1, scale, on, off, dest, pitch);
+        return;
+    }
+
+    uint32_t palette[UPSCALE_SHADES];
+    for (int shade = 0; shade < UPSCALE_SHADES; shade++)
+    {
+        palette[shade] = Blend(on, off, shade);
+    }
+    ExpandShades32(image->Shades, image->Width, 0, image->Height - 1, scale, palette, dest, pitch);
+}
@@ -0,0 +1,50 @@
+#ifndef UPSCALE_H
+#define UPSCALE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "CHIP8.h"
+
+// Largest Factor A Filter Scales By, & The Words That Make One Of Its Rows
+#define UPSCALE_MAX_FACTOR 4
+#define UPSCALE_MAX_WORDS (GRID_WIDTH * UPSCALE_MAX_FACTOR / 64)
+
+// Shades Of A Smoothed Pixel, 0 (Off) To UPSCALE_SHADES - 1 (On)
+#define UPSCALE_SHADES 5
+
+// A Filtered Display: Width x Height 1-Bit Pixels In Bits, Rows Of Words Packed As In Chip8.Display, Or For A
+// Shaded Filter One Shade Per Pixel In Shades, Rows Of Width Bytes
+typedef struct
+{
+    int Width;
+    int Height;
+    int Words;
+    bool Shaded;
+    uint64_t Bits[GRID_HEIGHT * UPSCALE_MAX_FACTOR * UPSCALE_MAX_WORDS];
+    uint8_t Shades[GRID_WIDTH * GRID_HEIGHT * UPSCALE_MAX_FACTOR * UPSCALE_MAX_FACTOR];
+
+} UPSCALE_IMAGE;
+
+typedef struct
+{
+    const char *Name;
+    int Factor;
+    bool Shaded;
+    void (*Run)(const uint64_t *display, UPSCALE_IMAGE *image);
+
+} UPSCALE_FILTER;
+
+// Active Filter (NULL Unless One Is Selected: The Display Goes Out As It Is)
+extern const UPSCALE_FILTER *Upscaler;
+
+bool SelectUpscaler(const char *name);
+
+// Runs The Active Filter Over display (Chip8.Display's Packing)
+void UpscaleDisplay(const uint64_t *display, UPSCALE_IMAGE *image);
+
+// A Filtered Image Through The Expansion Kernels, Each Of Its Pixels scale x scale (See Expand.h). Shades Blend
+// Between off & on Channel By Channel; ExpandRows1 Takes Unshaded Images Directly
+void UpscaleExpand8(const UPSCALE_IMAGE *image, int scale, uint8_t on, uint8_t off, void *dest, int pitch);
+void UpscaleExpand32(const UPSCALE_IMAGE *image, int scale, uint32_t on, uint32_t off, void *dest, int pitch);
+
+#endif
@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include "CHIP8.h"
+#include "Trace.h"
+#include "Vip.h"
+
+bool VipActive = false;
+uint64_t VipInstructions = 0;
+
+void VipInitialize()
+{
+    // Timers Tick On The Display Interrupt, Once Per Frame Of Machine Cycles
+    Chip8.TickCycles = VIP_FRAME_CYCLES;
+    VipActive = true;
+}
+
+// Machine Cycles An Instruction Took On Top Of The Fetch (Approximate Costs Of The VIP Interpreter's Routines).
+// `column` Is V[X] Before Executing (DXYN Can Overwrite It Through VF), `skipped` Whether A Skip Was Taken
+static uint32_t VipCost(const DecodedInstruction *D, uint8_t column, bool skipped)
+{
+    uint32_t skip = skipped ? 4 : 0;
+
+    switch (D->Opcode >> 12)
+    {
+    case 0x0:
+        if (D->Opcode == 0x00E0)
+        {
+            return 3078;
+        }
+        return (D->Opcode == 0x00EE) ? 10 : 0;
+
+    case 0x1:
+        return 12;
+
+    case 0x2:
+        return 26;
+
+    case 0x3:
+    case 0x4:
+        return 10 + skip;
+
+    case 0x5:
+    case 0x9:
+        return 14 + skip;
+
+    case 0x6:
+        return 6;
+
+    case 0x7:
+        return 10;
+
+    case 0x8:
+        return (D->N == 0x0) ? 12 : 44;
+
+    case 0xA:
+        return 12;
+
+    case 0xB:
+        return 22;
+
+    case 0xC:
+        return 36;
+
+    case 0xD:
+        // Each Row Is Shifted Into Place, Taking Longer & Touching Two Bytes When Not Byte Aligned
+        return 26 + D->N * ((column & 7) ? 66 : 46);
+
+    case 0xE:
+        return 14 + skip;
+
+    case 0xF:
+        switch (D->NN)
+        {
+        case 0x07:
+        case 0x15:
+        case 0x18:
+            return 10;
+
+        case 0x0A:
+            return 19;
+
+        case 0x1E:
+        case 0x29:
+            return 16;
+
+        case 0x33:
+            // Digits Come From Repeated Subtraction
+            return 80 + 16 * (column / 100 + column / 10 % 10 + column % 10);
+
+        case 0x55:
+        case 0x65:
+            return 14 + 14 * (D->X + 1);
+        }
+        return 0;
+    }
+    return 0;
+}
+
+// Advance Machine Time, Each Display Interrupt Passed Stealing Its Own Cycles On Top
+static void Spend(uint64_t cycles)
+{
+    uint64_t frame = Chip8.Cycles / VIP_FRAME_CYCLES;
+    Chip8.Cycles += cycles;
+    while (frame < Chip8.Cycles / VIP_FRAME_CYCLES)
+    {
+        frame++;
+        Chip8.Cycles += VIP_DISPLAY_CYCLES;
+    }
+}
+
+// Run Until The Next 60Hz Frame Boundary, Charging Each Instruction Its Machine Cycles
+void VipExecuteFrame()
+{
+    uint64_t end = (Chip8.Cycles / VIP_FRAME_CYCLES + 1) * VIP_FRAME_CYCLES;
+
+    while (Chip8.Cycles < end)
+    {
+        // FX0A Sleeps Through The Rest Of The Frame
+        if (WaitingForKey())
+        {
+            Spend(end - Chip8.Cycles);
+            break;
+        }
+
+        // Copy Of The Instruction About To Run (Running It Can Invalidate Its Own Entry)
+        uint16_t PC = Chip8.PC;
+        DecodedInstruction D;
+        if (PC < MEMORY_SIZE - 1 && DecodedMemory[PC].Handler != Op_Decode)
+        {
+            D = DecodedMemory[PC];
+        }
+        else
+        {
+            DecodeInstruction(PC, &D);
+        }
+        uint8_t column = Chip8.V[D.X];
+
+        // The Interpreter Counts One Cycle, Replaced By The Real Cost Below
+        uint64_t start = Chip8.Cycles;
+        ExecuteInstructions();
+        Chip8.Cycles = start;
+        VipInstructions++;
+
+        // DXYN Waits For The Display Interrupt Before Drawing, Which Ends The Frame
+        if ((D.Opcode & 0xF000) == 0xD000)
+        {
+            Spend(end - Chip8.Cycles);
+        }
+        Spend(VIP_FETCH_CYCLES + VipCost(&D, column, Chip8.PC == (uint16_t)(PC + 4)));
+    }
+}
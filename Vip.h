@@ -0,0 +1,21 @@
+#ifndef VIP_H
+#define VIP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "CHIP8.h"
+
+// COSMAC VIP Timing: Chip8.Cycles Counts 1802 Machine Cycles (8 Clocks At 1.7609 MHz) Instead Of Instructions
+#define VIP_FRAME_CYCLES 3668      // One 60Hz Frame
+#define VIP_DISPLAY_CYCLES 1070    // Display Interrupt: 128 Lines Of 8 DMA Cycles Plus The Interrupt Routine
+#define VIP_FETCH_CYCLES 40        // Interpreter Fetch & Dispatch, Paid By Every Instruction
+
+extern bool VipActive;
+
+// Instructions Run Under VIP Timing
+extern uint64_t VipInstructions;
+
+void VipInitialize();
+void VipExecuteFrame();
+
+#endif